@@ -52,7 +52,7 @@ check_roundtrip "encfile/decfile 1 MiB round-trip" "$TMP/large.bin" "$TMP/large_
 python3 - "$TMP/large.hkx" "$TMP/large_tampered.hkx" <<'PYEOF'
 import sys
 data = bytearray(open(sys.argv[1], 'rb').read())
-mid = 45 + (len(data) - 45 - 32) // 2
+mid = 41 + (len(data) - 41 - 32) // 2
 data[mid] ^= 0xFF
 open(sys.argv[2], 'wb').write(data)
 PYEOF
@@ -61,10 +61,169 @@ check_reject "decfile rejects tampered ciphertext" \
     "$CLI" decfile --algo hske-nla1 --key "$TMP/sk.pem" \
     --in "$TMP/large_tampered.hkx" --out "$TMP/large_tampered_dec.bin"
 
+# ── HKX2 segments: small --chunk, truncation, reordering, HKX1 input ─────────
+head -c 1000 "$TMP/large.bin" > "$TMP/seg.bin"
+"$CLI" encfile --algo hske-nla1 --key "$TMP/sk.pem" --chunk 256 \
+               --in "$TMP/seg.bin" --out "$TMP/seg.hkx"
+"$CLI" decfile --algo hske-nla1 --key "$TMP/sk.pem" \
+               --in "$TMP/seg.hkx" --out "$TMP/seg_dec.bin"
+check_roundtrip "encfile/decfile 4-segment round-trip (--chunk 256)" "$TMP/seg.bin" "$TMP/seg_dec.bin"
+
+python3 - "$TMP/seg.hkx" "$TMP" <<'PYEOF'
+import sys
+data, tmp = open(sys.argv[1], 'rb').read(), sys.argv[2]
+hdr, body, rec = data[:41], data[41:], 256 + 32
+segs = [body[i:i + rec] for i in range(0, len(body), rec)]
+open(tmp + '/seg_trunc.hkx', 'wb').write(hdr + b''.join(segs[:2]))
+open(tmp + '/seg_swap.hkx', 'wb').write(hdr + segs[1] + segs[0] + b''.join(segs[2:]))
+PYEOF
+check_reject "decfile rejects truncation at a segment boundary" \
+    "$CLI" decfile --algo hske-nla1 --key "$TMP/sk.pem" \
+    --in "$TMP/seg_trunc.hkx" --out "$TMP/seg_trunc_dec.bin"
+check_reject "decfile rejects reordered segments" \
+    "$CLI" decfile --algo hske-nla1 --key "$TMP/sk.pem" \
+    --in "$TMP/seg_swap.hkx" --out "$TMP/seg_swap_dec.bin"
+if [ -e "$TMP/seg_trunc_dec.bin" ]; then
+    echo "FAIL decfile removes partial output on failure"
+    FAIL=$((FAIL+1))
+else
+    echo "PASS decfile removes partial output on failure"
+    PASS=$((PASS+1))
+fi
+for chunk in 4294967328 64k -32 ""; do
+    check_reject "encfile rejects --chunk '$chunk'" \
+        "$CLI" encfile --algo hske-nla1 --key "$TMP/sk.pem" --chunk "$chunk" \
+        --in "$TMP/seg.bin" --out "$TMP/seg_badchunk.hkx"
+done
+check_reject "encfile fails on an unreadable input" \
+    "$CLI" encfile --algo hske-nla1 --key "$TMP/sk.pem" \
+    --in "$TMP" --out "$TMP/dir.hkx"
+if [ -e "$TMP/dir.hkx" ]; then
+    echo "FAIL encfile removes partial output on failure"
+    FAIL=$((FAIL+1))
+else
+    echo "PASS encfile removes partial output on failure"
+    PASS=$((PASS+1))
+fi
+
+python3 - "$(dirname "$0")/../HerraduraCli" "$TMP/sk.pem" "$TMP/seg.bin" "$TMP/legacy.hkx" <<'PYEOF'
+import sys
+sys.path.insert(0, sys.argv[1])
+import herradura as h
+key_int, _ = h._load_key(sys.argv[2])
+pt = open(sys.argv[3], 'rb').read()
+nonce = h.BitArray.random(256)
+base, seed, mac_iv = h._hkx_schedule(key_int, nonce.uint)
+ct = h._hkx_xor_ks(seed, base, 0, pt + bytes(-len(pt) % 32))
+nb, lb = nonce.uint.to_bytes(32, 'big'), len(pt).to_bytes(8, 'big')
+open(sys.argv[4], 'wb').write(b'HKX1\x01' + lb + nb + ct + h.hfscx_256(nb + lb + ct, iv=mac_iv))
+PYEOF
+"$CLI" decfile --algo hske-nla1 --key "$TMP/sk.pem" \
+               --in "$TMP/legacy.hkx" --out "$TMP/legacy_dec.bin"
+check_roundtrip "decfile still reads HKX1 containers" "$TMP/seg.bin" "$TMP/legacy_dec.bin"
+
+# ── --threads: pooled keystream decrypts with any thread count ───────────────
+"$CLI" encfile --algo hske-nla1 --key "$TMP/sk.pem" --threads 4 --chunk 4096 \
+               --in "$TMP/large.bin" --out "$TMP/large_t4.hkx"
+"$CLI" decfile --algo hske-nla1 --key "$TMP/sk.pem" --threads 3 \
+               --in "$TMP/large_t4.hkx" --out "$TMP/large_t4_t3.bin"
+check_roundtrip "encfile --threads 4 / decfile --threads 3 round-trip" \
+    "$TMP/large.bin" "$TMP/large_t4_t3.bin"
+"$CLI" decfile --algo hske-nla1 --key "$TMP/sk.pem" \
+               --in "$TMP/large_t4.hkx" --out "$TMP/large_t4_t1.bin"
+check_roundtrip "encfile --threads 4 / decfile single-thread round-trip" \
+    "$TMP/large.bin" "$TMP/large_t4_t1.bin"
+
+# ── --threads windows: batch boundaries, exact multiples, rejection ──────────
+head -c 1024 "$TMP/large.bin" > "$TMP/mult.bin"
+for th in 2 4 5; do
+    "$CLI" encfile --algo hske-nla1 --key "$TMP/sk.pem" --chunk 256 --threads "$th" \
+                   --in "$TMP/mult.bin" --out "$TMP/mult_$th.hkx"
+    "$CLI" decfile --algo hske-nla1 --key "$TMP/sk.pem" --threads 3 \
+                   --in "$TMP/mult_$th.hkx" --out "$TMP/mult_${th}_dec.bin"
+    check_roundtrip "encfile --threads $th, 4 full segments, decfile --threads 3" \
+        "$TMP/mult.bin" "$TMP/mult_${th}_dec.bin"
+done
+check_reject "decfile --threads 3 rejects truncation at a segment boundary" \
+    "$CLI" decfile --algo hske-nla1 --key "$TMP/sk.pem" --threads 3 \
+    --in "$TMP/seg_trunc.hkx" --out "$TMP/seg_trunc_t3.bin"
+check_reject "decfile --threads 3 rejects reordered segments" \
+    "$CLI" decfile --algo hske-nla1 --key "$TMP/sk.pem" --threads 3 \
+    --in "$TMP/seg_swap.hkx" --out "$TMP/seg_swap_t3.bin"
+for th in abc 4x -1 1025 ""; do
+    check_reject "encfile rejects --threads '$th'" \
+        "$CLI" encfile --algo hske-nla1 --key "$TMP/sk.pem" --threads "$th" \
+        --in "$TMP/mult.bin" --out "$TMP/mult_badth.hkx"
+done
+"$CLI" decfile --algo hske-nla1 --key "$TMP/sk.pem" --threads 0 \
+               --in "$TMP/mult_4.hkx" --out "$TMP/mult_4_all.bin"
+check_roundtrip "decfile --threads 0 (every online CPU)" "$TMP/mult.bin" "$TMP/mult_4_all.bin"
+"$CLI" encfile --algo hske-nla1 --key "$TMP/sk.pem" --threads 1024 --chunk 16777216 \
+               --in "$TMP/mult.bin" --out "$TMP/mult_big.hkx"
+"$CLI" decfile --algo hske-nla1 --key "$TMP/sk.pem" --threads 1024 \
+               --in "$TMP/mult_big.hkx" --out "$TMP/mult_big_dec.bin"
+check_roundtrip "--threads 1024 with 16 MiB segments (window capped by bytes)" \
+    "$TMP/mult.bin" "$TMP/mult_big_dec.bin"
+
+# ── --offset/--length: decrypt one range, authenticating only its segments ───
+for range in "0 10" "4090 20" "100000 8192" "1048000 1000" "524288"; do
+    set -- $range
+    off=$1; len=${2:-}
+    if [ -n "$len" ]; then
+        "$CLI" decfile --algo hske-nla1 --key "$TMP/sk.pem" --threads 2 \
+                       --in "$TMP/large_t4.hkx" --out "$TMP/range.bin" \
+                       --offset "$off" --length "$len"
+    else
+        "$CLI" decfile --algo hske-nla1 --key "$TMP/sk.pem" \
+                       --in "$TMP/large_t4.hkx" --out "$TMP/range.bin" --offset "$off"
+    fi
+    python3 -c "import sys; d = open(sys.argv[1], 'rb').read()[int(sys.argv[2]):]
+sys.stdout.buffer.write(d[:int(sys.argv[3])] if sys.argv[3] else d)" \
+        "$TMP/large.bin" "$off" "$len" > "$TMP/range_ref.bin"
+    check_roundtrip "decfile --offset $off --length ${len:-<rest>}" \
+        "$TMP/range_ref.bin" "$TMP/range.bin"
+done
+python3 - "$TMP/large_t4.hkx" "$TMP/range_tampered.hkx" <<'PYEOF'
+import sys
+data = bytearray(open(sys.argv[1], 'rb').read())
+data[41 + 3 * (4096 + 32) + 5] ^= 0x01      # inside segment 3
+open(sys.argv[2], 'wb').write(data)
+PYEOF
+"$CLI" decfile --algo hske-nla1 --key "$TMP/sk.pem" --in "$TMP/range_tampered.hkx" \
+               --out "$TMP/range_clean.bin" --offset 0 --length 4096
+head -c 4096 "$TMP/large.bin" > "$TMP/range_clean_ref.bin"
+check_roundtrip "decfile range outside a tampered segment still decrypts" \
+    "$TMP/range_clean_ref.bin" "$TMP/range_clean.bin"
+check_reject "decfile range rejects a tampered segment it covers" \
+    "$CLI" decfile --algo hske-nla1 --key "$TMP/sk.pem" --in "$TMP/range_tampered.hkx" \
+    --out "$TMP/range_bad.bin" --offset 12300 --length 100
+check_reject "decfile rejects --offset past the end of the plaintext" \
+    "$CLI" decfile --algo hske-nla1 --key "$TMP/sk.pem" --in "$TMP/large_t4.hkx" \
+    --out "$TMP/range_past.bin" --offset 2000000
+check_reject "decfile --offset rejects HKX1 containers" \
+    "$CLI" decfile --algo hske-nla1 --key "$TMP/sk.pem" --in "$TMP/legacy.hkx" \
+    --out "$TMP/range_hkx1.bin" --offset 0 --length 10
+for arg in "--length abc" "--length 5x" "--offset -1" "--offset 1e3" "--length -1"; do
+    check_reject "decfile rejects $arg" \
+        "$CLI" decfile --algo hske-nla1 --key "$TMP/sk.pem" --in "$TMP/large_t4.hkx" \
+        --out "$TMP/range_badarg.bin" $arg
+done
+"$CLI" genpkey --algo hkex-gf --out "$TMP/carol.pem"
+"$CLI" kex     --algo hkex-gf --our "$TMP/carol.pem" --their "$TMP/bob_pub.pem" \
+               --out "$TMP/wrong_sk.pem"
+for off in 0 5000 1048576; do
+    check_reject "decfile --offset $off --length 0 authenticates with the wrong key" \
+        "$CLI" decfile --algo hske-nla1 --key "$TMP/wrong_sk.pem" --in "$TMP/large_t4.hkx" \
+        --out "$TMP/range_empty_bad.bin" --offset "$off" --length 0
+    "$CLI" decfile --algo hske-nla1 --key "$TMP/sk.pem" --in "$TMP/large_t4.hkx" \
+                   --out "$TMP/range_empty.bin" --offset "$off" --length 0
+    check_roundtrip "decfile --offset $off --length 0 is empty" /dev/null "$TMP/range_empty.bin"
+done
+
 # ── Edge cases: 0-byte, 1-byte, 32-byte ──────────────────────────────────────
 for size in 0 1 32; do
     python3 -c "import os; open('$TMP/edge_${size}.bin','wb').write(os.urandom($size))"
-    "$CLI" encfile --algo hske-nla1 --key "$TMP/sk.pem" \
+    "$CLI" encfile --algo hske-nla1 --key "$TMP/sk.pem" --threads 2 \
                    --in "$TMP/edge_${size}.bin" --out "$TMP/edge_${size}.hkx"
     "$CLI" decfile --algo hske-nla1 --key "$TMP/sk.pem" \
                    --in "$TMP/edge_${size}.hkx" --out "$TMP/edge_${size}_dec.bin"
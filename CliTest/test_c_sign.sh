@@ -59,6 +59,49 @@ check_reject "verify hpks wrong key" \
     "$CLI" verify --algo hpks --pubkey "$TMP/hpks_other_pub.pem" \
     --in "$TMP/msg32.bin" --sig "$TMP/hpks_sig.pem"
 
+# ── HPKS batch verification (--batch LIST) ──────────────────────────────────
+: > "$TMP/batch.lst"
+echo "# pubkey message signature" >> "$TMP/batch.lst"
+for i in 0 1 2 3 4 5; do
+    key="$TMP/hpks.pem"; pub="$TMP/hpks_pub.pem"
+    if [ $((i % 2)) -eq 1 ]; then key="$TMP/hpks_other.pem"; pub="$TMP/hpks_other_pub.pem"; fi
+    printf 'batch message %d' "$i" > "$TMP/bmsg$i.bin"
+    "$CLI" sign --algo hpks --key "$key" --in "$TMP/bmsg$i.bin" \
+                --digest hfscx-256 --out "$TMP/bsig$i.pem"
+    echo "$pub $TMP/bmsg$i.bin $TMP/bsig$i.pem" >> "$TMP/batch.lst"
+done
+out=$("$CLI" verify --algo hpks --batch "$TMP/batch.lst" --digest hfscx-256 2>&1) && rc=0 || rc=$?
+if [ "$rc" -eq 0 ] && echo "$out" | grep -q "Batch OK: 6 signatures"; then
+    echo "PASS verify hpks --batch (6 valid)"; PASS=$((PASS+1))
+else
+    echo "FAIL verify hpks --batch (6 valid) (rc=$rc): $out"; FAIL=$((FAIL+1))
+fi
+printf 'tampered' > "$TMP/bmsg3.bin"
+out=$("$CLI" verify --algo hpks --batch "$TMP/batch.lst" --digest hfscx-256 2>&1) && rc=0 || rc=$?
+if [ "$rc" -ne 0 ] && echo "$out" | grep -q "Verification FAILED: entry 4"; then
+    echo "PASS verify hpks --batch tampered entry reported"; PASS=$((PASS+1))
+else
+    echo "FAIL verify hpks --batch tampered entry (rc=$rc): $out"; FAIL=$((FAIL+1))
+fi
+
+# ── Mapped files and pipes: dgst / sign --digest see the same bytes ────────
+dd if=/dev/urandom of="$TMP/large.bin" count=2048 bs=512 2>/dev/null
+: > "$TMP/empty.bin"
+for f in large empty; do
+    d_map=$("$CLI" dgst --in "$TMP/$f.bin")
+    d_pipe=$(cat "$TMP/$f.bin" | "$CLI" dgst --in -)
+    if [ "$d_map" = "$d_pipe" ]; then
+        echo "PASS dgst $f file matches stdin"; PASS=$((PASS+1))
+    else
+        echo "FAIL dgst $f file '$d_map' != stdin '$d_pipe'"; FAIL=$((FAIL+1))
+    fi
+done
+"$CLI" sign --algo hpks --key "$TMP/hpks.pem" --in "$TMP/large.bin" \
+            --digest hfscx-256 --out "$TMP/large_sig.pem"
+check_verify "verify hpks --digest of a piped copy of a mapped file" \
+    sh -c 'cat "$1" | "$2" verify --algo hpks --pubkey "$3" --in - --sig "$4" --digest hfscx-256' \
+    _ "$TMP/large.bin" "$CLI" "$TMP/hpks_pub.pem" "$TMP/large_sig.pem"
+
 # ── HPKS-Stern-F (N=256, rounds=32) ─────────────────────────────────────────
 "$CLI" genpkey --algo hpks-stern --out "$TMP/hpks_stern.pem"
 "$CLI" pkey    --in "$TMP/hpks_stern.pem" --pubout --out "$TMP/hpks_stern_pub.pem"
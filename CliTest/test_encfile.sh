@@ -61,9 +61,9 @@ check_roundtrip "encfile/decfile 1 MiB round-trip" "$TMP/large.bin" "$TMP/large_
 python3 - <<'PYEOF' "$TMP/large.hkx" "$TMP/large_tampered.hkx"
 import sys
 data = bytearray(open(sys.argv[1], 'rb').read())
-# ciphertext body starts at byte 45 (4 magic + 1 algo + 8 len + 32 nonce)
-# flip a byte in the middle of the ciphertext, well before the 32-byte tag
-mid = 45 + (len(data) - 45 - 32) // 2
+# HKX2 segments start at byte 41 (4 magic + 1 algo + 4 seg size + 32 nonce)
+# flip a byte in the middle of the body, well before the last segment's tag
+mid = 41 + (len(data) - 41 - 32) // 2
 data[mid] ^= 0xFF
 open(sys.argv[2], 'wb').write(data)
 PYEOF
@@ -72,6 +72,66 @@ check_reject "decfile rejects tampered ciphertext" \
     $CLI decfile --algo hske-nla1 --key "$TMP/sk.pem" \
     --in "$TMP/large_tampered.hkx" --out "$TMP/large_tampered_dec.bin"
 
+# ---------------------------------------------------------------------------
+# HKX2 segments: small --chunk, truncation, reordering, HKX1 input
+# ---------------------------------------------------------------------------
+
+head -c 1000 "$TMP/large.bin" > "$TMP/seg.bin"
+$CLI encfile --algo hske-nla1 --key "$TMP/sk.pem" --chunk 256 \
+               --in "$TMP/seg.bin" --out "$TMP/seg.hkx"
+$CLI decfile --algo hske-nla1 --key "$TMP/sk.pem" \
+               --in "$TMP/seg.hkx" --out "$TMP/seg_dec.bin"
+check_roundtrip "encfile/decfile 4-segment round-trip (--chunk 256)" "$TMP/seg.bin" "$TMP/seg_dec.bin"
+
+python3 - "$TMP/seg.hkx" "$TMP" <<'PYEOF'
+import sys
+data, tmp = open(sys.argv[1], 'rb').read(), sys.argv[2]
+hdr, body, rec = data[:41], data[41:], 256 + 32
+segs = [body[i:i + rec] for i in range(0, len(body), rec)]
+open(tmp + '/seg_trunc.hkx', 'wb').write(hdr + b''.join(segs[:2]))
+open(tmp + '/seg_swap.hkx', 'wb').write(hdr + segs[1] + segs[0] + b''.join(segs[2:]))
+PYEOF
+check_reject "decfile rejects truncation at a segment boundary" \
+    $CLI decfile --algo hske-nla1 --key "$TMP/sk.pem" \
+    --in "$TMP/seg_trunc.hkx" --out "$TMP/seg_trunc_dec.bin"
+check_reject "decfile rejects reordered segments" \
+    $CLI decfile --algo hske-nla1 --key "$TMP/sk.pem" \
+    --in "$TMP/seg_swap.hkx" --out "$TMP/seg_swap_dec.bin"
+if [ -e "$TMP/seg_trunc_dec.bin" ]; then
+    echo "FAIL decfile removes partial output on failure"
+    FAIL=$((FAIL+1))
+else
+    echo "PASS decfile removes partial output on failure"
+    PASS=$((PASS+1))
+fi
+# /proc/self/mem opens but fails on the first read, after --out exists
+check_reject "encfile fails on an unreadable input" \
+    $CLI encfile --algo hske-nla1 --key "$TMP/sk.pem" \
+    --in /proc/self/mem --out "$TMP/mem.hkx"
+if [ -e "$TMP/mem.hkx" ]; then
+    echo "FAIL encfile removes partial output on failure"
+    FAIL=$((FAIL+1))
+else
+    echo "PASS encfile removes partial output on failure"
+    PASS=$((PASS+1))
+fi
+
+python3 - "$(dirname "$0")/../HerraduraCli" "$TMP/sk.pem" "$TMP/seg.bin" "$TMP/legacy.hkx" <<'PYEOF'
+import sys
+sys.path.insert(0, sys.argv[1])
+import herradura as h
+key_int, _ = h._load_key(sys.argv[2])
+pt = open(sys.argv[3], 'rb').read()
+nonce = h.BitArray.random(256)
+base, seed, mac_iv = h._hkx_schedule(key_int, nonce.uint)
+ct = h._hkx_xor_ks(seed, base, 0, pt + bytes(-len(pt) % 32))
+nb, lb = nonce.uint.to_bytes(32, 'big'), len(pt).to_bytes(8, 'big')
+open(sys.argv[4], 'wb').write(b'HKX1\x01' + lb + nb + ct + h.hfscx_256(nb + lb + ct, iv=mac_iv))
+PYEOF
+$CLI decfile --algo hske-nla1 --key "$TMP/sk.pem" \
+               --in "$TMP/legacy.hkx" --out "$TMP/legacy_dec.bin"
+check_roundtrip "decfile still reads HKX1 containers" "$TMP/seg.bin" "$TMP/legacy_dec.bin"
+
 # ---------------------------------------------------------------------------
 # Edge cases: 0-byte, 1-byte, 32-byte (one full block)
 # ---------------------------------------------------------------------------
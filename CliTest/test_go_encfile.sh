@@ -52,7 +52,7 @@ check_roundtrip "encfile/decfile 1 MiB round-trip" "$TMP/large.bin" "$TMP/large_
 python3 - "$TMP/large.hkx" "$TMP/large_tampered.hkx" <<'PYEOF'
 import sys
 data = bytearray(open(sys.argv[1], 'rb').read())
-mid = 45 + (len(data) - 45 - 32) // 2
+mid = 41 + (len(data) - 41 - 32) // 2
 data[mid] ^= 0xFF
 open(sys.argv[2], 'wb').write(data)
 PYEOF
@@ -61,6 +61,67 @@ check_reject "decfile rejects tampered ciphertext" \
     "$CLI" decfile --algo hske-nla1 --key "$TMP/sk.pem" \
     --in "$TMP/large_tampered.hkx" --out "$TMP/large_tampered_dec.bin"
 
+# ── HKX2 segments: small --chunk, truncation, reordering, HKX1 input ─────────
+head -c 1000 "$TMP/large.bin" > "$TMP/seg.bin"
+"$CLI" encfile --algo hske-nla1 --key "$TMP/sk.pem" --chunk 256 \
+               --in "$TMP/seg.bin" --out "$TMP/seg.hkx"
+"$CLI" decfile --algo hske-nla1 --key "$TMP/sk.pem" \
+               --in "$TMP/seg.hkx" --out "$TMP/seg_dec.bin"
+check_roundtrip "encfile/decfile 4-segment round-trip (--chunk 256)" "$TMP/seg.bin" "$TMP/seg_dec.bin"
+
+python3 - "$TMP/seg.hkx" "$TMP" <<'PYEOF'
+import sys
+data, tmp = open(sys.argv[1], 'rb').read(), sys.argv[2]
+hdr, body, rec = data[:41], data[41:], 256 + 32
+segs = [body[i:i + rec] for i in range(0, len(body), rec)]
+open(tmp + '/seg_trunc.hkx', 'wb').write(hdr + b''.join(segs[:2]))
+open(tmp + '/seg_swap.hkx', 'wb').write(hdr + segs[1] + segs[0] + b''.join(segs[2:]))
+PYEOF
+check_reject "decfile rejects truncation at a segment boundary" \
+    "$CLI" decfile --algo hske-nla1 --key "$TMP/sk.pem" \
+    --in "$TMP/seg_trunc.hkx" --out "$TMP/seg_trunc_dec.bin"
+check_reject "decfile rejects reordered segments" \
+    "$CLI" decfile --algo hske-nla1 --key "$TMP/sk.pem" \
+    --in "$TMP/seg_swap.hkx" --out "$TMP/seg_swap_dec.bin"
+if [ -e "$TMP/seg_trunc_dec.bin" ]; then
+    echo "FAIL decfile removes partial output on failure"
+    FAIL=$((FAIL+1))
+else
+    echo "PASS decfile removes partial output on failure"
+    PASS=$((PASS+1))
+fi
+for chunk in 4294967328 64k -32 ""; do
+    check_reject "encfile rejects --chunk '$chunk'" \
+        "$CLI" encfile --algo hske-nla1 --key "$TMP/sk.pem" --chunk "$chunk" \
+        --in "$TMP/seg.bin" --out "$TMP/seg_badchunk.hkx"
+done
+check_reject "encfile fails on an unreadable input" \
+    "$CLI" encfile --algo hske-nla1 --key "$TMP/sk.pem" \
+    --in "$TMP" --out "$TMP/dir.hkx"
+if [ -e "$TMP/dir.hkx" ]; then
+    echo "FAIL encfile removes partial output on failure"
+    FAIL=$((FAIL+1))
+else
+    echo "PASS encfile removes partial output on failure"
+    PASS=$((PASS+1))
+fi
+
+python3 - "$(dirname "$0")/../HerraduraCli" "$TMP/sk.pem" "$TMP/seg.bin" "$TMP/legacy.hkx" <<'PYEOF'
+import sys
+sys.path.insert(0, sys.argv[1])
+import herradura as h
+key_int, _ = h._load_key(sys.argv[2])
+pt = open(sys.argv[3], 'rb').read()
+nonce = h.BitArray.random(256)
+base, seed, mac_iv = h._hkx_schedule(key_int, nonce.uint)
+ct = h._hkx_xor_ks(seed, base, 0, pt + bytes(-len(pt) % 32))
+nb, lb = nonce.uint.to_bytes(32, 'big'), len(pt).to_bytes(8, 'big')
+open(sys.argv[4], 'wb').write(b'HKX1\x01' + lb + nb + ct + h.hfscx_256(nb + lb + ct, iv=mac_iv))
+PYEOF
+"$CLI" decfile --algo hske-nla1 --key "$TMP/sk.pem" \
+               --in "$TMP/legacy.hkx" --out "$TMP/legacy_dec.bin"
+check_roundtrip "decfile still reads HKX1 containers" "$TMP/seg.bin" "$TMP/legacy_dec.bin"
+
 # ── Edge cases: 0-byte, 1-byte, 32-byte ──────────────────────────────────────
 for size in 0 1 32; do
     python3 -c "import os; open('$TMP/edge_${size}.bin','wb').write(os.urandom($size))"
@@ -117,6 +117,13 @@ $CLI_PY  encfile --algo hske-nla1 --key "$TMP/alice_sk.pem" --in "$TMP/msg.bin"
 $CLI_JAVA decfile --algo hske-nla1 --key "$TMP/alice_sk.pem" --in "$TMP/p2j.hkx" --out "$TMP/p2j_hkx_out.bin"
 check_roundtrip "encfile: Python -> Java decfile" "$TMP/msg.bin" "$TMP/p2j_hkx_out.bin"
 
+# Multi-segment HKX2: Java must verify every segment and reassemble a short
+# final one.
+head -c 1000 /dev/urandom > "$TMP/big.bin"
+$CLI_PY  encfile --algo hske-nla1 --key "$TMP/alice_sk.pem" --chunk 64 --in "$TMP/big.bin" --out "$TMP/p2j_seg.hkx"
+$CLI_JAVA decfile --algo hske-nla1 --key "$TMP/alice_sk.pem" --in "$TMP/p2j_seg.hkx" --out "$TMP/p2j_seg_out.bin"
+check_roundtrip "encfile: Python -> Java decfile (64-byte segments)" "$TMP/big.bin" "$TMP/p2j_seg_out.bin"
+
 echo ""
 echo "Results: $PASS PASS / $FAIL FAIL"
 [ "$FAIL" -eq 0 ]
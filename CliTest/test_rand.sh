@@ -37,6 +37,16 @@ done
 check "rand KAT py==c" "$TMP/k_py.hex" "$TMP/k_c.hex"
 check "rand KAT py==go" "$TMP/k_py.hex" "$TMP/k_go.hex"
 
+# Bulk mode (C only): deterministic, a distinct stream, resumable from a checkpoint
+"$C" rand --seed "$TMP/seed.bin" --bulk --bytes 100000 --out "$TMP/b1.bin"
+"$C" rand --seed "$TMP/seed.bin" --bulk --bytes 100000 --out "$TMP/b2.bin"
+"$C" rand --seed "$TMP/seed.bin" --bytes 100000 --out "$TMP/b_std.bin"
+check        "rand --bulk determinism (c)"      "$TMP/b1.bin" "$TMP/b2.bin"
+check_differ "rand --bulk vs per-block stream"  "$TMP/b1.bin" "$TMP/b_std.bin"
+"$C" rand --seed "$TMP/seed.bin" --state "$TMP/bst.pem" --bulk --bytes 64 --out "$TMP/bs1.bin"
+"$C" rand --state "$TMP/bst.pem" --bulk --bytes 64 --out "$TMP/bs2.bin"
+check_differ "rand --bulk requests do not repeat" "$TMP/bs1.bin" "$TMP/bs2.bin"
+
 # Personalization separation (per language) + cross-language KAT for one pers
 for impl in py c go; do
     ${CLI[$impl]} rand --seed "$TMP/seed.bin" --personalization "ctx-A" --bytes 48 --hex --out "$TMP/pa_$impl.hex"
@@ -4,7 +4,14 @@
      -t, --time   T   benchmark duration and per-test wall-clock cap in seconds
    Env:  HTEST_ROUNDS=N  HTEST_TIME=T  (CLI flags override env) */
 
-/*  Herradura KEx -- Security & Performance Tests (C, multi-size BitArray + scalar GF) v1.9.91
+/*  Herradura KEx -- Security & Performance Tests (C, multi-size BitArray + scalar GF) v1.9.96
+    v1.9.96: test [48] also covers gf_pow2_vartime_ba (Straus g^a·X^b for verification).
+    v1.9.95: test [48] also covers the 4-bit fixed-window variable-base gf_pow_win_ba.
+    v1.9.94: test [48] — fixed-base GF_GEN table exponentiation vs gf_pow_ba.
+    v1.9.93: test [47] — gf_mul_ba PCLMULQDQ / portable carry-less backends vs the
+            shift-and-XOR reference, HKEX-GF KAT.
+    v1.9.92: test [46] — closed-form FSCX_REVOLVE engine vs iterative, HSKE KAT under both
+            engines and the per-key HskeKey cache (TODO #213).
     v1.9.91: test [45] — weak-key/malformed-input rejection: HKEX-GF/HPKS/HPKE reject
             identity/zero public elements (herradura.h TODO #131 hardening), HPKS-Stern-F
             rejects a corrupted syndrome, HSKE-NL-A1-AEAD rejects tampered ciphertext.
@@ -111,8 +118,42 @@
       [42] ZKP-RNL sign+verify throughput (n=256)  [PQC-EXT].
       [43] ZKP-NL prove+verify throughput (n=32, rounds=16)  [PQC-EXT].
 
-    Security test [44] appended after benchmarks to preserve [32]–[43] numbering:
+    Security tests [44]+ appended after benchmarks to preserve [32]–[43] numbering:
       [44] HCRED hybrid credential: completeness + tamper/replay rejection  [PQC-EXT].
+      [45] Weak-key & malformed-input rejection  [SECURITY].
+      [46] Closed-form FSCX_REVOLVE engine == iterative engine, HSKE KAT  [CLASSICAL].
+      [47] gf_mul_ba carry-less backends == shift-and-XOR reference, HKEX-GF KAT  [CLASSICAL].
+      [48] GF exponentiation engines (fixed-base, window, Straus) == gf_pow_ba  [CLASSICAL].
+      [49] HPKS batch verification: valid batches accept, tampered/malleated item located  [CLASSICAL].
+      [50] Scalar arithmetic mod 2^256-1 (limbs) == byte-wise reference, inverse  [CLASSICAL].
+      [51] 256-bit limb add/sub/mul and NL-FSCX v2 == byte-wise reference  [NL].
+      [52] Keyed NlV2Ctx revolve/inverse == byte-wise reference, weak-key check  [NL].
+      [53] Rotation-free m_inv_ba == byte-wise M^{-1}, inverts fscx(x, 0)  [NL].
+      [54] Streaming HfscxCtx == one-shot HFSCX-256 / -DS / HMAC for any split  [HASH].
+      [55] Multi-buffer HFSCX-256 (1..8 lanes, both backends) == per-lane hfscx_256  [HASH].
+      [56] HmacHfscxKey midstates: reused key == hmac_hfscx_256, streaming split  [HASH].
+      [57] HKX2 segments: per-segment keystream == whole stream, tag midstate == one-shot,
+           index and final flag bound  [HSKE].
+      [58] ParPool CTR keystream: hske_nla1_xor_ks_par == serial for 1..6 threads,
+           every worker index run exactly once  [HSKE].
+      [59] HKX2 batches: hkx2_seal_batch == per-segment seal for 1..4 threads,
+           hkx2_open_batch round-trips and stops at the first tampered segment  [HSKE].
+      [60] HSKE-NL-A1 lane keystream (portable and AVX2) == per-block keystream,
+           HSKE-NL-AEAD round-trip and tamper rejection  [HSKE].
+      [61] HSKE-NL-AEAD encrypt throughput: per-block reference vs lane kernel.
+      [62] Streaming HSKE-NL-V2-Duplex == one-shot for any split, streaming decrypt,
+           tamper rejection zeroes the output  [HSKE].
+      [63] HSKE-NL-V2-Duplex (one-shot, streaming) vs HSKE-NL-AEAD encrypt throughput.
+      [64] HDRBG bulk mode == its definition, one ratchet per request, block limit,
+           HDrbgBuf split reads == batch stream; per-block vs bulk throughput  [HDRBG].
+      [65] Entropy source: HERRADURA_OS_RNG split/large reads, consumed bytes wiped,
+           fresh buffer after fork(), FILE* adapter; sampler rate FILE* vs OS  [RNG].
+      [66] Lazy-reduction negacyclic NTT: rnl_poly_mul_dim == twist/NTT/untwist
+           reference at n=1024 and n=256 for canonical and arbitrary int32 inputs;
+           reference vs lazy multiply rate  [PQC].
+      [67] RNL SIMD backend == portable backend: poly multiply (n=1024, 256), round_p
+           and lift_q incl. out-of-range inputs and ragged tails, HKEX-RNL agree;
+           handshake rate per backend  [PQC].
 
     Copyright (C) 2024-2026 Omar Alejandro Herrera Reyna
 
@@ -127,6 +168,8 @@
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
 #include "../herradura.h"
 
 static FILE *urnd_fp;
@@ -999,6 +1042,13 @@ static int time_exceeded(struct timespec *t0)
     return elapsed_sec(t0, &t1) >= g_time_limit;
 }
 
+/* ParPool job for test [58]: record which worker indices ran. */
+static void _test_par_count(void *arg, int k, int n)
+{
+    (void)n;
+    ((int *)arg)[k]++;
+}
+
 /* ------------------------------------------------------------------ */
 /* Security tests [1]-[6]: HKEX-GF and FSCX primitives               */
 /* ------------------------------------------------------------------ */
@@ -4883,6 +4933,101 @@ static void bench_hkex_rnl_handshake(void)
     putchar('\n');
 }
 
+/* [61] HSKE-NL-AEAD throughput: per-block reference vs lane kernel backends.
+ * The reference encrypts one counter block per NL-FSCX v1 revolve, which is
+ * what hske_nla1_xor_ks did before the multi-lane kernel. */
+static void _aead_ref_encrypt(const BitArray *key, const BitArray *nonce,
+                              const uint8_t *ad, size_t ad_len,
+                              const uint8_t *pt, size_t pt_len,
+                              uint8_t *ct, uint8_t tag[32])
+{
+    BitArray base, seed, mac_key, ks;
+    size_t off, j;
+    ba_xor(&base, key, nonce);
+    ba_rnl_kdf_seed(&seed, &base);
+    for (off = 0; off < pt_len; off += KEYBYTES) {
+        hske_nla1_ks_block(&seed, &base, (uint32_t)(off / KEYBYTES), &ks);
+        for (j = 0; j < KEYBYTES && off + j < pt_len; j++) ct[off + j] = pt[off + j] ^ ks.b[j];
+    }
+    hske_nla1_mac_key(&seed, &base, &mac_key);
+    _hske_nl_aead_tag(&mac_key, nonce, ad, ad_len, ct, pt_len, tag);
+}
+
+static void bench_hske_nl_aead(void)
+{
+    static uint8_t pt[16384], ct[16384];
+    uint8_t tag[32], ad[16] = {0};
+    BitArray K, N;
+    struct timespec t0, t1;
+    long long ops;
+    double secs;
+    int pass;
+    void (*saved)(BaWords *, const BaWords *, int, int);
+    printf("[61] HSKE-NL-AEAD encrypt throughput, 16 KiB messages  [HSKE]\n");
+    if (fread(pt, 1, sizeof pt, urnd_fp) != sizeof pt) { fprintf(stderr, "urandom read\n"); exit(1); }
+    ba_rand(&K, urnd_fp);
+    ba_rand(&N, urnd_fp);
+    hfscx_mb_dispatch_init();
+    saved = _nl_v1_revolve_mb;
+    for (pass = 0; pass < 3; pass++) {
+        const char *name = pass == 0 ? "per-block" : pass == 1 ? "lanes/portable" : "lanes/avx2";
+        if (pass == 2 && saved == _nl_v1_revolve_mb_soft) break;
+        _nl_v1_revolve_mb = pass == 2 ? saved : _nl_v1_revolve_mb_soft;
+        ops = 0; clock_gettime(CLOCK_MONOTONIC, &t0);
+        do {
+            if (pass == 0) _aead_ref_encrypt(&K, &N, ad, sizeof ad, pt, sizeof pt, ct, tag);
+            else hske_nl_aead_encrypt(&K, &N, ad, sizeof ad, pt, sizeof pt, ct, tag);
+            ops++; clock_gettime(CLOCK_MONOTONIC, &t1);
+        } while ((secs = elapsed_sec(&t0, &t1)) < g_bench_sec);
+        printf("    %-15s %.2f MB/s  (%lld msgs in %.2fs)\n", name,
+               (double)ops * sizeof pt / secs / 1.0e6, ops, secs);
+    }
+    _nl_v1_revolve_mb = saved;
+    putchar('\n');
+}
+
+/* [63] HSKE-NL-V2-Duplex vs HSKE-NL-AEAD encrypt throughput, 16 KiB messages;
+ * the streaming duplex is fed 1000-byte pieces. */
+static void bench_hske_duplex(void)
+{
+    static uint8_t pt[16384], ct[16384];
+    uint8_t tag[32], ad[16] = {0};
+    BitArray K, N;
+    struct timespec t0, t1;
+    long long ops;
+    double secs;
+    int pass;
+    printf("[63] HSKE-NL-V2-Duplex vs HSKE-NL-AEAD encrypt throughput, 16 KiB messages  [HSKE]\n");
+    if (fread(pt, 1, sizeof pt, urnd_fp) != sizeof pt) { fprintf(stderr, "urandom read\n"); exit(1); }
+    ba_rand(&K, urnd_fp);
+    ba_rand(&N, urnd_fp);
+    for (pass = 0; pass < 3; pass++) {
+        static const char *const name[3] = {"hske-nla1 aead", "duplex one-shot", "duplex stream"};
+        ops = 0; clock_gettime(CLOCK_MONOTONIC, &t0);
+        do {
+            if (pass == 0) {
+                hske_nl_aead_encrypt(&K, &N, ad, sizeof ad, pt, sizeof pt, ct, tag);
+            } else if (pass == 1) {
+                hske_nl_v2_duplex_encrypt(&K, &N, ad, sizeof ad, pt, sizeof pt, ct, tag);
+            } else {
+                HskeDuplexCtx c;
+                size_t off, n;
+                hske_nl_v2_duplex_init(&c, &K, &N);
+                hske_nl_v2_duplex_absorb_ad(&c, ad, sizeof ad);
+                for (off = 0; off < sizeof pt; off += n) {
+                    n = sizeof pt - off < 1000 ? sizeof pt - off : 1000;
+                    hske_nl_v2_duplex_encrypt_update(&c, pt + off, n, ct + off);
+                }
+                hske_nl_v2_duplex_encrypt_final(&c, tag);
+            }
+            ops++; clock_gettime(CLOCK_MONOTONIC, &t1);
+        } while ((secs = elapsed_sec(&t0, &t1)) < g_bench_sec);
+        printf("    %-16s %.2f MB/s  (%lld msgs in %.2fs)\n", name[pass],
+               (double)ops * sizeof pt / secs / 1.0e6, ops, secs);
+    }
+    putchar('\n');
+}
+
 /* ------------------------------------------------------------------ */
 /* main                                                                 */
 /* ------------------------------------------------------------------ */
@@ -5243,6 +5388,1212 @@ int main(int argc, char *argv[])
         }
     }
 
+    /* ------------------------------------------------------------------ */
+    /* Security test [46]: closed-form FSCX_REVOLVE engine (TODO #213).    */
+    /* m^i*A ^ T_i*B must match the iterative engine byte-for-byte, the    */
+    /* HSKE vector in KAT/classical_quartet.json must hold under both      */
+    /* engines and under the per-key HskeKey cache.                        */
+    /* ------------------------------------------------------------------ */
+    {
+        static const uint8_t kat_key[KEYBYTES] = {
+            0xca,0xfe,0xba,0xbe,0xde,0xad,0xbe,0xef,0x01,0x23,0x45,0x67,0x89,0xab,0xcd,0xef,
+            0xca,0xfe,0xba,0xbe,0xde,0xad,0xbe,0xef,0x01,0x23,0x45,0x67,0x89,0xab,0xcd,0xef
+        };
+        static const uint8_t kat_pt[KEYBYTES] = {
+            0x00,0x48,0x65,0x72,0x72,0x61,0x64,0x75,0x72,0x61,0x4b,0x45,0x78,0x20,0x54,0x4f,
+            0x44,0x4f,0x20,0x23,0x31,0x39,0x30,0x20,0x4b,0x41,0x54,0x20,0x74,0x65,0x73,0x74
+        };
+        static const uint8_t kat_ct[KEYBYTES] = {
+            0xc6,0x97,0x85,0xe8,0x81,0xdb,0xbc,0xb1,0xc9,0x99,0xf1,0xeb,0xc4,0x87,0xff,0xe5,
+            0x82,0x90,0xc0,0xb9,0xc2,0x83,0xe8,0xe4,0xf0,0xb9,0xee,0x8e,0xc8,0xc2,0xd8,0xde
+        };
+        int N = g_rounds > 0 ? g_rounds : 200;
+        int ok_kat = 1, ok_eq = 0, ok_key = 0;
+        int i, e, prev;
+        struct timespec ts0;
+        clock_gettime(CLOCK_MONOTONIC, &ts0);
+
+        printf("[46] Closed-form FSCX_REVOLVE engine == iterative engine, HSKE KAT  [CLASSICAL]\n");
+
+        {
+            BitArray key, pt, ct, out;
+            HskeKey hk;
+            memcpy(key.b, kat_key, KEYBYTES);
+            memcpy(pt.b,  kat_pt,  KEYBYTES);
+            memcpy(ct.b,  kat_ct,  KEYBYTES);
+            for (e = 0; e < 2; e++) {
+                prev = fscx_revolve_set_engine(e ? FSCX_REVOLVE_CLOSED_FORM
+                                                 : FSCX_REVOLVE_ITERATIVE);
+                hske_encrypt(&pt, &key, &out);
+                if (!ba_equal(&out, &ct)) ok_kat = 0;
+                hske_decrypt(&ct, &key, &out);
+                if (!ba_equal(&out, &pt)) ok_kat = 0;
+                fscx_revolve_set_engine(prev);
+            }
+            hske_key_init(&hk, &key);
+            hske_encrypt_k(&pt, &hk, &out);
+            if (!ba_equal(&out, &ct)) ok_kat = 0;
+            hske_decrypt_k(&ct, &hk, &out);
+            if (!ba_equal(&out, &pt)) ok_kat = 0;
+        }
+
+        for (i = 0; i < N; i++) {
+            BitArray a, b, r_it, r_cf, r_k;
+            FscxRevolveKey rk;
+            int steps;
+            ba_rand(&a, urnd_fp);
+            ba_rand(&b, urnd_fp);
+            steps = (i < 4) ? (i == 0 ? 0 : i == 1 ? 1 : i == 2 ? I_VALUE : R_VALUE)
+                            : (int)(a.b[0] | ((a.b[1] & 1) << 8)) + 1;   /* 1..512 */
+            ba_fscx_revolve_iter(&r_it, &a, &b, steps);
+            ba_fscx_revolve_closed(&r_cf, &a, &b, steps);
+            if (ba_equal(&r_it, &r_cf)) ok_eq++;
+            fscx_revolve_key_init(&rk, &b, steps);
+            fscx_revolve_key_apply(&r_k, &a, &rk);
+            if (ba_equal(&r_it, &r_k)) ok_key++;
+            if (g_time_limit > 0.0 && time_exceeded(&ts0)) { N = i + 1; break; }
+        }
+        {
+            const char *status = (ok_kat && ok_eq == N && ok_key == N) ? "PASS" : "FAIL";
+            printf("    n=%d  hske_kat=%s  closed==iter=%d/%d  keyed==iter=%d/%d  [%s]\n\n",
+                   N, ok_kat ? "ok" : "MISMATCH", ok_eq, N, ok_key, N, status);
+        }
+    }
+
+    /* ------------------------------------------------------------------ */
+    /* Security test [47]: carry-less gf_mul_ba backends.  The dispatched  */
+    /* backend (PCLMULQDQ where available) and the portable Karatsuba      */
+    /* path must both match the shift-and-XOR reference, and the HKEX-GF   */
+    /* vector from KAT/classical_quartet.json must hold.                   */
+    /* ------------------------------------------------------------------ */
+    {
+        static const uint8_t kat_priv[KEYBYTES] = {
+            0x1a,0x2b,0x3c,0x4d,0x5e,0x6f,0x70,0x81,0x92,0xa3,0xb4,0xc5,0xd6,0xe7,0xf8,0x09,
+            0x1a,0x2b,0x3c,0x4d,0x5e,0x6f,0x70,0x81,0x92,0xa3,0xb4,0xc5,0xd6,0xe7,0xf8,0x09
+        };
+        static const uint8_t kat_pub[KEYBYTES] = {
+            0x80,0xc3,0x30,0xd0,0x98,0x4f,0x3f,0xbe,0x3e,0x32,0x33,0xdf,0xad,0x68,0x3d,0x90,
+            0x43,0xc2,0xda,0xda,0xe3,0x4b,0x0a,0xf6,0x74,0xbe,0xc2,0xeb,0xaf,0x5d,0xbb,0x85
+        };
+        int N = g_rounds > 0 ? g_rounds : 1000;
+        int ok_kat, ok_disp = 0, ok_soft = 0;
+        int i, j;
+        struct timespec ts0;
+        clock_gettime(CLOCK_MONOTONIC, &ts0);
+
+        printf("[47] gf_mul_ba carry-less backends == shift-and-XOR reference, HKEX-GF KAT  [CLASSICAL]\n");
+
+        {
+            BitArray priv, pub;
+            memcpy(priv.b, kat_priv, KEYBYTES);
+            hkex_gf_pubkey(&priv, &pub);
+            ok_kat = memcmp(pub.b, kat_pub, KEYBYTES) == 0;
+        }
+
+        for (i = 0; i < N; i++) {
+            BitArray a, b, r_ref, r_disp;
+            BaWords wa, wb;
+            uint64_t la[4], lb[4], prod[8], red[4], ld[4];
+            ba_rand(&a, urnd_fp);
+            ba_rand(&b, urnd_fp);
+            if (i == 0) memset(a.b, 0xFF, KEYBYTES);          /* all-ones edge case */
+            if (i == 1) { memset(a.b, 0, KEYBYTES); a.b[0] = 0x80; b = a; }   /* x^255 squared */
+            gf_mul_ba_ref(&r_ref, &a, &b);
+            gf_mul_ba(&r_disp, &a, &b);
+            if (ba_equal(&r_ref, &r_disp)) ok_disp++;
+            baw_load(&wa, &a); baw_load(&wb, &b);
+            for (j = 0; j < 4; j++) { la[j] = wa.w[3 - j]; lb[j] = wb.w[3 - j]; }
+            gf_clmul256_soft(prod, la, lb);
+            gf_reduce512(red, prod);
+            baw_load(&wa, &r_ref);
+            for (j = 0; j < 4; j++) ld[j] = wa.w[3 - j];
+            if (memcmp(red, ld, sizeof(red)) == 0) ok_soft++;
+            if (g_time_limit > 0.0 && time_exceeded(&ts0)) { N = i + 1; break; }
+        }
+        {
+            const char *status = (ok_kat && ok_disp == N && ok_soft == N) ? "PASS" : "FAIL";
+            printf("    n=%d  backend=%s  hkex_gf_kat=%s  dispatched==ref=%d/%d"
+                   "  portable==ref=%d/%d  [%s]\n\n",
+                   N, gf_clmul256 == gf_clmul256_soft ? "portable" : "pclmul",
+                   ok_kat ? "ok" : "MISMATCH", ok_disp, N, ok_soft, N, status);
+        }
+    }
+
+    /* ------------------------------------------------------------------ */
+    /* Security test [48]: GF exponentiation engines.  gf_pow_gen_ba       */
+    /* (fixed-base table), gf_pow_win_ba (fixed window) and                */
+    /* gf_pow2_vartime_ba (Straus double exponentiation) must agree with   */
+    /* gf_pow_ba for random and edge exponents (0, 1, all-ones).           */
+    /* ------------------------------------------------------------------ */
+    {
+        int N = g_rounds > 0 ? g_rounds : 100;
+        int ok = 0, ok_win = 0, ok_dbl = 0, i;
+        struct timespec ts0;
+        clock_gettime(CLOCK_MONOTONIC, &ts0);
+
+        printf("[48] GF exponentiation engines (fixed-base, window, Straus) == gf_pow_ba  [CLASSICAL]\n");
+
+        for (i = 0; i < N; i++) {
+            BitArray e, x, y, r_tbl, r_pow, r_win, r_dbl, t1, t2;
+            ba_rand(&e, urnd_fp);
+            if (i == 0) memset(e.b, 0, KEYBYTES);
+            if (i == 1) { memset(e.b, 0, KEYBYTES); e.b[KEYBYTES - 1] = 1; }
+            if (i == 2) memset(e.b, 0xFF, KEYBYTES);
+            gf_pow_gen_ba(&r_tbl, &e);
+            gf_pow_ba(&r_pow, &GF_GEN, &e);
+            if (ba_equal(&r_tbl, &r_pow)) ok++;
+            ba_rand(&x, urnd_fp);
+            gf_pow_win_ba(&r_win, &x, &e);
+            gf_pow_ba(&r_pow, &x, &e);
+            if (ba_equal(&r_win, &r_pow)) ok_win++;
+            ba_rand(&y, urnd_fp);
+            if (i == 3) memset(y.b, 0, KEYBYTES);
+            gf_pow2_vartime_ba(&r_dbl, &GF_GEN, &e, &x, &y);
+            gf_pow_ba(&t1, &GF_GEN, &e);
+            gf_pow_ba(&t2, &x, &y);
+            gf_mul_ba(&t1, &t1, &t2);
+            if (ba_equal(&r_dbl, &t1)) ok_dbl++;
+            if (g_time_limit > 0.0 && time_exceeded(&ts0)) { N = i + 1; break; }
+        }
+        printf("    n=%d  table==pow=%d/%d  window==pow=%d/%d  straus==pow*pow=%d/%d  [%s]\n\n",
+               N, ok, N, ok_win, N, ok_dbl, N,
+               (ok == N && ok_win == N && ok_dbl == N) ? "PASS" : "FAIL");
+    }
+
+    /* ------------------------------------------------------------------ */
+    /* Security test [49]: hpks_verify_batch.  A batch of valid HPKS       */
+    /* signatures under mixed keys must be accepted; corrupting one item   */
+    /* (message, R, s, or s + ord/p for a small prime p | ord, which       */
+    /* leaves a small-order error) must be rejected and bad_idx must name  */
+    /* that item.                                                          */
+    /* ------------------------------------------------------------------ */
+    {
+#define T49_BATCH 8
+        int N = g_rounds > 0 ? g_rounds : 20;
+        int acc = 0, rej = 0, i, j;
+        struct timespec ts0;
+        clock_gettime(CLOCK_MONOTONIC, &ts0);
+
+        printf("[49] HPKS batch verification: valid batches accept, tampered/malleated item located  [CLASSICAL]\n");
+
+        for (i = 0; i < N; i++) {
+            BitArray priv[2], pub[2], msgs[T49_BATCH], pubs[T49_BATCH];
+            BitArray Rs[T49_BATCH], ss[T49_BATCH];
+            size_t bad = (size_t)-1, victim;
+            for (j = 0; j < 2; j++) {
+                ba_rand(&priv[j], urnd_fp);
+                hkex_gf_pubkey(&priv[j], &pub[j]);
+            }
+            for (j = 0; j < T49_BATCH; j++) {
+                ba_rand(&msgs[j], urnd_fp);
+                pubs[j] = pub[j & 1];
+                hpks_sign(&msgs[j], &priv[j & 1], &Rs[j], &ss[j], urnd_fp);
+            }
+            if (hpks_verify_batch(msgs, pubs, Rs, ss, T49_BATCH, urnd_fp, NULL) == 1) acc++;
+            victim = (size_t)(i % T49_BATCH);
+            switch (i % 4) {
+            case 0:  msgs[victim].b[0] ^= 0x01; break;
+            case 1:  Rs[victim].b[KEYBYTES - 1] ^= 0x01; break;
+            case 2:  ss[victim].b[KEYBYTES / 2] ^= 0x80; break;
+            default: {
+                /* ord/p for p = 3, 5, 17: the bytes 0x55.., 0x33.., 0x0F.. */
+                static const uint8_t pat[3] = { 0x55, 0x33, 0x0F };
+                BitArray d, t;
+                memset(d.b, pat[(i / 4) % 3], KEYBYTES);
+                ba_add_mod_ord(&t, &ss[victim], &d);
+                ss[victim] = t;
+                break;
+            }
+            }
+            if (hpks_verify_batch(msgs, pubs, Rs, ss, T49_BATCH, urnd_fp, &bad) == 0 && bad == victim)
+                rej++;
+            if (g_time_limit > 0.0 && time_exceeded(&ts0)) { N = i + 1; break; }
+        }
+        printf("    n=%d batch=%d  valid accepted=%d/%d  tampered located=%d/%d  [%s]\n\n",
+               N, T49_BATCH, acc, N, rej, N, (acc == N && rej == N) ? "PASS" : "FAIL");
+#undef T49_BATCH
+    }
+
+    /* ------------------------------------------------------------------ */
+    /* Security test [50]: ba_mul/add/sub_mod_ord (64-bit limbs, fold      */
+    /* reduction) must match the byte-wise bn_*_mod_ord_n reference for    */
+    /* random and edge operands (0, 1, ord-1, all-ones); ba_modinv_ord     */
+    /* must satisfy a·a^-1 == 1 exactly when gcd(a, ord) == 1.             */
+    /* ------------------------------------------------------------------ */
+    {
+        int N = g_rounds > 0 ? g_rounds : 2000;
+        int ok_arith = 0, ok_inv = 0, i, j, k;
+        struct timespec ts0;
+        clock_gettime(CLOCK_MONOTONIC, &ts0);
+
+        printf("[50] Scalar arithmetic mod 2^256-1 (limbs) == byte-wise reference, inverse  [CLASSICAL]\n");
+
+        for (i = 0; i < N; i++) {
+            BitArray a, b, r, inv, chk;
+            uint8_t ref[KEYBYTES];
+            int good = 1, all_ff;
+            ba_rand(&a, urnd_fp);
+            ba_rand(&b, urnd_fp);
+            switch (i % 8) {
+            case 1: memset(a.b, 0, KEYBYTES); break;
+            case 2: memset(a.b, 0, KEYBYTES); a.b[KEYBYTES - 1] = 1; break;
+            case 3: memset(a.b, 0xFF, KEYBYTES); a.b[KEYBYTES - 1] = 0xFE; break;
+            case 4: memset(a.b, 0xFF, KEYBYTES); break;
+            case 5: memset(b.b, 0xFF, KEYBYTES); break;
+            default: break;
+            }
+            for (k = 0; k < 3; k++) {
+                if (k == 0) { ba_mul_mod_ord(&r, &a, &b); bn_mul_mod_ord_n(ref, a.b, b.b, KEYBITS); }
+                if (k == 1) { ba_add_mod_ord(&r, &a, &b); bn_add_mod_ord_n(ref, a.b, b.b, KEYBITS); }
+                if (k == 2) { ba_sub_mod_ord(&r, &a, &b); bn_sub_mod_ord_n(ref, a.b, b.b, KEYBITS); }
+                all_ff = 1;
+                for (j = 0; j < KEYBYTES; j++) all_ff &= (ref[j] == 0xFF);
+                if (all_ff) memset(ref, 0, KEYBYTES);
+                if (memcmp(r.b, ref, KEYBYTES) != 0) good = 0;
+            }
+            ok_arith += good;
+
+            ba_modinv_ord(&inv, &a);
+            ba_mul_mod_ord(&chk, &a, &inv);
+            switch (i % 8) {
+            case 1: case 4:                 /* a ≡ 0: no inverse */
+                good = !ba_equal(&chk, &ONE_BA); break;
+            case 2:
+                good = ba_equal(&inv, &ONE_BA); break;
+            case 3:                         /* -1 is its own inverse */
+                good = ba_equal(&inv, &a); break;
+            case 6: {                       /* 3·a shares the factor 3 with ord */
+                BitArray three;
+                memset(three.b, 0, KEYBYTES); three.b[KEYBYTES - 1] = 3;
+                ba_mul_mod_ord(&a, &a, &three);
+                ba_modinv_ord(&inv, &a);
+                ba_mul_mod_ord(&chk, &a, &inv);
+                good = !ba_equal(&chk, &ONE_BA);
+                break;
+            }
+            default:                        /* random: a unit about half the time */
+                good = 1;
+                if (ba_equal(&chk, &ONE_BA)) {
+                    ba_modinv_ord(&chk, &inv);
+                    good = ba_equal(&chk, &a);
+                }
+                break;
+            }
+            ok_inv += good;
+            if (g_time_limit > 0.0 && time_exceeded(&ts0)) { N = i + 1; break; }
+        }
+        printf("    n=%d  mul/add/sub==ref=%d/%d  inverse checks=%d/%d  [%s]\n\n",
+               N, ok_arith, N, ok_inv, N, (ok_arith == N && ok_inv == N) ? "PASS" : "FAIL");
+    }
+
+    /* ------------------------------------------------------------------ */
+    /* Security test [51]: ba_add256 / ba_sub256 / ba_mul256 (64-bit limbs */
+    /* with add-with-carry and a 4x4 low-half multiply) and the NL-FSCX v2 */
+    /* limb path (delta, one step, I_VALUE-step revolve) must match the    */
+    /* byte-wise bn_*_n references, including all-zero/all-ones operands.  */
+    /* ------------------------------------------------------------------ */
+    {
+        int N = g_rounds > 0 ? g_rounds : 2000;
+        int ok_int = 0, ok_v2 = 0, i;
+        struct timespec ts0;
+        clock_gettime(CLOCK_MONOTONIC, &ts0);
+
+        printf("[51] 256-bit limb add/sub/mul and NL-FSCX v2 == byte-wise reference  [NL]\n");
+
+        for (i = 0; i < N; i++) {
+            BitArray a, b, r;
+            uint8_t ref[KEYBYTES];
+            int good = 1;
+            ba_rand(&a, urnd_fp);
+            ba_rand(&b, urnd_fp);
+            if (i % 5 == 1) memset(a.b, 0xFF, KEYBYTES);
+            if (i % 5 == 2) memset(b.b, 0xFF, KEYBYTES);
+            if (i % 5 == 3) memset(b.b, 0, KEYBYTES);
+            ba_add256(&r, &a, &b); bn_add_n(ref, a.b, b.b, KEYBITS);
+            good &= memcmp(r.b, ref, KEYBYTES) == 0;
+            ba_sub256(&r, &a, &b); bn_sub_n(ref, a.b, b.b, KEYBITS);
+            good &= memcmp(r.b, ref, KEYBYTES) == 0;
+            ba_mul256(&r, &a, &b); bn_mul_lo_n(ref, a.b, b.b, KEYBITS);
+            good &= memcmp(r.b, ref, KEYBYTES) == 0;
+            ok_int += good;
+
+            good = 1;
+            nl_fscx_delta_v2_ba(&r, &b); bn_nl_delta_v2_n(ref, b.b, KEYBITS);
+            good &= memcmp(r.b, ref, KEYBYTES) == 0;
+            nl_fscx_v2_ba(&r, &a, &b); bn_nl_fscx_v2_n(ref, a.b, b.b, KEYBITS);
+            good &= memcmp(r.b, ref, KEYBYTES) == 0;
+            if (i % 8 == 0) {
+                nl_fscx_revolve_v2_ba(&r, &a, &b, I_VALUE);
+                bn_nl_fscx_revolve_v2_n(ref, a.b, b.b, I_VALUE, KEYBITS);
+                good &= memcmp(r.b, ref, KEYBYTES) == 0;
+            }
+            ok_v2 += good;
+            if (g_time_limit > 0.0 && time_exceeded(&ts0)) { N = i + 1; break; }
+        }
+        printf("    n=%d  add/sub/mul==ref=%d/%d  nl-fscx-v2==ref=%d/%d  [%s]\n\n",
+               N, ok_int, N, ok_v2, N, (ok_int == N && ok_v2 == N) ? "PASS" : "FAIL");
+    }
+
+    /* ------------------------------------------------------------------ */
+    /* Security test [52]: the keyed NlV2Ctx (B and delta(B) cached once)  */
+    /* must give the same forward/inverse revolve as the byte-wise          */
+    /* references, and nl_v2_ctx_is_valid must agree with                   */
+    /* nl_v2_key_is_valid, including the delta = 0 keys B = 0 and B = ~0.   */
+    /* ------------------------------------------------------------------ */
+    {
+        int N = g_rounds > 0 ? g_rounds : 500;
+        int ok_fwd = 0, ok_inv = 0, ok_valid = 0, i;
+        struct timespec ts0;
+        clock_gettime(CLOCK_MONOTONIC, &ts0);
+
+        printf("[52] Keyed NlV2Ctx revolve/inverse == byte-wise reference, weak-key check  [NL]\n");
+
+        for (i = 0; i < N; i++) {
+            BitArray a, b, r, back;
+            NlV2Ctx ctx;
+            uint8_t ref[KEYBYTES];
+            int steps = (i & 1) ? R_VALUE : I_VALUE;
+            ba_rand(&a, urnd_fp);
+            ba_rand(&b, urnd_fp);
+            if (i % 7 == 1) memset(b.b, 0, KEYBYTES);
+            if (i % 7 == 2) memset(b.b, 0xFF, KEYBYTES);
+            nl_v2_ctx_init(&ctx, &b);
+            ok_valid += nl_v2_ctx_is_valid(&ctx) == nl_v2_key_is_valid(&b);
+
+            nl_v2_ctx_revolve(&r, &a, &ctx, steps);
+            bn_nl_fscx_revolve_v2_n(ref, a.b, b.b, steps, KEYBITS);
+            ok_fwd += memcmp(r.b, ref, KEYBYTES) == 0;
+
+            nl_v2_ctx_revolve_inv(&back, &r, &ctx, steps);
+            bn_nl_fscx_revolve_v2_inv_n(ref, r.b, b.b, steps, KEYBITS);
+            ok_inv += memcmp(back.b, ref, KEYBYTES) == 0 && ba_equal(&back, &a);
+            if (g_time_limit > 0.0 && time_exceeded(&ts0)) { N = i + 1; break; }
+        }
+        printf("    n=%d  fwd==ref=%d/%d  inv==ref=%d/%d  valid==key_is_valid=%d/%d  [%s]\n\n",
+               N, ok_fwd, N, ok_inv, N, ok_valid, N,
+               (ok_fwd == N && ok_inv == N && ok_valid == N) ? "PASS" : "FAIL");
+    }
+
+    /* ------------------------------------------------------------------ */
+    /* Security test [53]: m_inv_ba (geometric-sum form of the period-3    */
+    /* M^{-1} polynomial) must match the byte-wise bn_m_inv_n table walk   */
+    /* and undo M, i.e. m_inv_ba(fscx(x, 0)) == x; nl_fscx_v2_inv_ba must  */
+    /* undo nl_fscx_v2_ba.                                                 */
+    /* ------------------------------------------------------------------ */
+    {
+        int N = g_rounds > 0 ? g_rounds : 2000;
+        int ok_ref = 0, ok_inv = 0, i;
+        struct timespec ts0;
+        clock_gettime(CLOCK_MONOTONIC, &ts0);
+
+        printf("[53] Rotation-free m_inv_ba == byte-wise M^{-1}, inverts fscx(x, 0)  [NL]\n");
+
+        for (i = 0; i < N; i++) {
+            BitArray x, b, y, r;
+            uint8_t ref[KEYBYTES];
+            int good = 1;
+            ba_rand(&x, urnd_fp);
+            ba_rand(&b, urnd_fp);
+            if (i == 1) memset(x.b, 0xFF, KEYBYTES);
+            m_inv_ba(&r, &x);
+            bn_m_inv_n(ref, x.b, KEYBITS);
+            ok_ref += memcmp(r.b, ref, KEYBYTES) == 0;
+
+            ba_fscx(&y, &x, &ZERO_BA);
+            m_inv_ba(&r, &y);
+            good &= ba_equal(&r, &x);
+            nl_fscx_v2_ba(&y, &x, &b);
+            nl_fscx_v2_inv_ba(&r, &y, &b);
+            good &= ba_equal(&r, &x);
+            ok_inv += good;
+            if (g_time_limit > 0.0 && time_exceeded(&ts0)) { N = i + 1; break; }
+        }
+        printf("    n=%d  m_inv==ref=%d/%d  inverts=%d/%d  [%s]\n\n",
+               N, ok_ref, N, ok_inv, N, (ok_ref == N && ok_inv == N) ? "PASS" : "FAIL");
+    }
+
+    /* ------------------------------------------------------------------ */
+    /* Security test [54]: HfscxCtx fed in random-sized pieces must equal  */
+    /* the one-shot hash of the concatenation; hfscx_256_ds must equal the */
+    /* hash of ds || data, and hmac_hfscx_256 the two-pass HMAC built from */
+    /* concatenated buffers.  Lengths straddle the 32-byte block edges.    */
+    /* ------------------------------------------------------------------ */
+    {
+        int N = g_rounds > 0 ? g_rounds : 500;
+        int ok_split = 0, ok_ds = 0, ok_hmac = 0, i;
+        struct timespec ts0;
+        clock_gettime(CLOCK_MONOTONIC, &ts0);
+
+        printf("[54] Streaming HfscxCtx == one-shot HFSCX-256 / -DS / HMAC for any split  [HASH]\n");
+
+        for (i = 0; i < N; i++) {
+            uint8_t msg[1 + 32 + 300], key[32], ref[32], got[32], inner[32], obuf[64];
+            uint8_t iv[32];
+            size_t len = (size_t)(i % 300), off = 0;
+            HfscxCtx c;
+            int j;
+            if (fread(msg, 1, sizeof msg, urnd_fp) != sizeof msg ||
+                fread(key, 1, 32, urnd_fp) != 32 ||
+                fread(iv, 1, 32, urnd_fp) != 32) { fprintf(stderr, "urandom read\n"); exit(1); }
+
+            hfscx_256(msg + 33, len, (i & 1) ? iv : NULL, ref);
+            hfscx_256_init(&c, (i & 1) ? iv : NULL);
+            while (off < len) {
+                size_t take = 1 + (size_t)(msg[off % 33] % 70);
+                if (take > len - off) take = len - off;
+                hfscx_256_update(&c, msg + 33 + off, take);
+                off += take;
+            }
+            hfscx_256_final(&c, got);
+            ok_split += memcmp(ref, got, 32) == 0;
+
+            msg[32] = 0x02;
+            hfscx_256(msg + 32, 1 + len, NULL, ref);
+            hfscx_256_ds(0x02, msg + 33, len, NULL, got);
+            ok_ds += memcmp(ref, got, 32) == 0;
+
+            for (j = 0; j < 32; j++) msg[1 + j] = key[j] ^ 0x36;
+            hfscx_256(msg + 1, 32 + len, NULL, inner);
+            for (j = 0; j < 32; j++) obuf[j] = key[j] ^ 0x5C;
+            memcpy(obuf + 32, inner, 32);
+            hfscx_256(obuf, 64, NULL, ref);
+            for (j = 0; j < 32; j++) msg[1 + j] = 0;   /* hmac reads msg + 33 only */
+            hmac_hfscx_256(key, msg + 33, len, got);
+            ok_hmac += memcmp(ref, got, 32) == 0;
+            if (g_time_limit > 0.0 && time_exceeded(&ts0)) { N = i + 1; break; }
+        }
+        printf("    n=%d  split==oneshot=%d/%d  ds=%d/%d  hmac=%d/%d  [%s]\n\n",
+               N, ok_split, N, ok_ds, N, ok_hmac, N,
+               (ok_split == N && ok_ds == N && ok_hmac == N) ? "PASS" : "FAIL");
+    }
+
+    /* ------------------------------------------------------------------ */
+    /* Security test [55]: hfscx_256_xn over 1..8 lanes must give each     */
+    /* lane's hfscx_256 digest under both the dispatched (AVX2 when        */
+    /* available) and the portable compression backends; stern_build_H    */
+    /* and haccum_root (multi-buffer callers) must match their per-item    */
+    /* definitions.                                                        */
+    /* ------------------------------------------------------------------ */
+    {
+        int N = g_rounds > 0 ? g_rounds : 300;
+        int ok_mb = 0, ok_callers = 0, i;
+        const char *backend;
+        struct timespec ts0;
+        clock_gettime(CLOCK_MONOTONIC, &ts0);
+
+        hfscx_mb_dispatch_init();
+        backend = _hfscx_compress_mb == _hfscx_compress_mb_soft ? "portable" : "avx2";
+        printf("[55] Multi-buffer HFSCX-256 (1..8 lanes, both backends) == per-lane hfscx_256  [HASH]\n");
+
+        for (i = 0; i < N; i++) {
+            static uint8_t msg[HFSCX_MB_LANES][200];
+            uint8_t dig[HFSCX_MB_LANES][32], ref[32], iv[32];
+            const uint8_t *in[HFSCX_MB_LANES];
+            uint8_t *out[HFSCX_MB_LANES];
+            int lanes = 1 + i % HFSCX_MB_LANES, j, pass, good = 1;
+            size_t len = (size_t)((i * 37) % 200);
+            if (fread(msg, 1, sizeof msg, urnd_fp) != sizeof msg ||
+                fread(iv, 1, 32, urnd_fp) != 32) { fprintf(stderr, "urandom read\n"); exit(1); }
+            for (j = 0; j < lanes; j++) { in[j] = msg[j]; out[j] = dig[j]; }
+            for (pass = 0; pass < 2; pass++) {
+                void (*saved)(BaWords *, const uint8_t *const[], int) = _hfscx_compress_mb;
+                if (pass) _hfscx_compress_mb = _hfscx_compress_mb_soft;
+                hfscx_256_xn(in, lanes, len, (i & 2) ? iv : NULL, out);
+                _hfscx_compress_mb = saved;
+                for (j = 0; j < lanes; j++) {
+                    hfscx_256(msg[j], len, (i & 2) ? iv : NULL, ref);
+                    good &= memcmp(ref, dig[j], 32) == 0;
+                }
+            }
+            ok_mb += good;
+
+            if (i % 50 == 0) {
+                BitArray seed, H[SDF_N_ROWS], row;
+                uint8_t leaves[11][KEYBYTES], nodes[16][KEYBYTES], root[KEYBYTES];
+                size_t sz;
+                int k;
+                good = 1;
+                ba_rand(&seed, urnd_fp);
+                stern_build_H(H, &seed);
+                for (k = 0; k < SDF_N_ROWS; k++) {
+                    stern_matrix_row(&row, &seed, k);
+                    good &= ba_equal(&row, &H[k]);
+                }
+                if (fread(leaves, 1, sizeof leaves, urnd_fp) != sizeof leaves) exit(1);
+                haccum_root((const uint8_t (*)[KEYBYTES])leaves, 11, root);
+                memset(nodes, 0, sizeof nodes);
+                memcpy(nodes, leaves, sizeof leaves);
+                for (sz = 16; sz > 1; sz /= 2)
+                    for (k = 0; k < (int)sz / 2; k++)
+                        haccum_node(nodes[2 * k], nodes[2 * k + 1], nodes[k]);
+                good &= memcmp(root, nodes[0], KEYBYTES) == 0;
+                ok_callers += good;
+            }
+            if (g_time_limit > 0.0 && time_exceeded(&ts0)) { N = i + 1; break; }
+        }
+        printf("    n=%d  backend=%s  lanes==hfscx_256=%d/%d  stern_build_H/haccum_root=%d/%d  [%s]\n\n",
+               N, backend, ok_mb, N, ok_callers, (N + 49) / 50,
+               (ok_mb == N && ok_callers == (N + 49) / 50) ? "PASS" : "FAIL");
+    }
+
+    /* ------------------------------------------------------------------ */
+    /* Security test [56]: one HmacHfscxKey reused across many messages    */
+    /* must give hmac_hfscx_256 for each, whether the message is fed in    */
+    /* one call or split across hfscx_256_update calls.                    */
+    /* ------------------------------------------------------------------ */
+    {
+        int N = g_rounds > 0 ? g_rounds : 500;
+        int ok_one = 0, ok_split = 0, i;
+        uint8_t key[32];
+        HmacHfscxKey hk;
+        struct timespec ts0;
+        clock_gettime(CLOCK_MONOTONIC, &ts0);
+
+        printf("[56] HmacHfscxKey midstates: reused key == hmac_hfscx_256, streaming split  [HASH]\n");
+
+        for (i = 0; i < N; i++) {
+            uint8_t msg[150], ref[32], got[32];
+            size_t len = (size_t)(i % 150), cut;
+            HfscxCtx c;
+            if (i % 100 == 0) {
+                if (fread(key, 1, 32, urnd_fp) != 32) exit(1);
+                hmac_hfscx_key_init(&hk, key);
+            }
+            if (fread(msg, 1, sizeof msg, urnd_fp) != sizeof msg) exit(1);
+            hmac_hfscx_256(key, msg, len, ref);
+            hmac_hfscx_256_k(&hk, msg, len, got);
+            ok_one += memcmp(ref, got, 32) == 0;
+
+            cut = len ? (size_t)msg[0] % len : 0;
+            hmac_hfscx_init(&c, &hk);
+            hfscx_256_update(&c, msg, cut);
+            hfscx_256_update(&c, msg + cut, len - cut);
+            hmac_hfscx_final(&c, &hk, got);
+            ok_split += memcmp(ref, got, 32) == 0;
+            if (g_time_limit > 0.0 && time_exceeded(&ts0)) { N = i + 1; break; }
+        }
+        explicit_bzero(&hk, sizeof hk);
+        printf("    n=%d  keyed==hmac=%d/%d  split==hmac=%d/%d  [%s]\n\n",
+               N, ok_one, N, ok_split, N, (ok_one == N && ok_split == N) ? "PASS" : "FAIL");
+    }
+
+    /* ------------------------------------------------------------------ */
+    /* Security test [57]: HKX2 segment helpers.  Keystream applied one    */
+    /* segment at a time (hske_nla1_xor_ks at block i*seg/32) must equal   */
+    /* the whole-stream XOR; hkx2_seg_tag from the midstate must equal a   */
+    /* one-shot HFSCX-256 over the framed segment; flipping the index or   */
+    /* the final flag must change the tag.                                 */
+    /* ------------------------------------------------------------------ */
+    {
+        int N = g_rounds > 0 ? g_rounds : 200;
+        int ok_ks = 0, ok_tag = 0, ok_bind = 0, i;
+        struct timespec ts0;
+        clock_gettime(CLOCK_MONOTONIC, &ts0);
+
+        printf("[57] HKX2 segments: per-segment keystream == whole stream, tag midstate == one-shot, index/final bound  [HSKE]\n");
+
+        for (i = 0; i < N; i++) {
+            uint8_t pt[256], whole[256], segd[256], msg[8 + 32 + 4 + 9 + 64];
+            uint8_t mac_iv[32], ref[32], got[32], alt[32];
+            uint32_t seg = 32u * (1 + (uint32_t)(i % 4));
+            size_t off, len = (size_t)(i % 257), n, m = 0;
+            uint64_t idx = (uint64_t)i * 977u;
+            BitArray K, nonce, base, seed, mac_key;
+            HfscxCtx pre;
+            int j, good = 1;
+            if (len > sizeof pt) len = sizeof pt;
+            ba_rand(&K, urnd_fp); ba_rand(&nonce, urnd_fp);
+            if (fread(pt, 1, sizeof pt, urnd_fp) != sizeof pt) exit(1);
+            ba_xor(&base, &K, &nonce);
+            ba_rnl_kdf_seed(&seed, &base);
+
+            hske_nla1_xor_ks(&seed, &base, 0, pt, len, whole);
+            for (off = 0; off < len; off += seg) {
+                n = (len - off < seg) ? len - off : seg;
+                hske_nla1_xor_ks(&seed, &base, (uint32_t)(off / KEYBYTES),
+                                 pt + off, n, segd + off);
+            }
+            ok_ks += len == 0 || memcmp(whole, segd, len) == 0;
+
+            hske_nla1_mac_key(&seed, &base, &mac_key);
+            hkx2_tag_init(&pre, &mac_key, &nonce, seg);
+            n = len < 64 ? len : 64;
+            hkx2_seg_tag(&pre, idx, i & 1, whole, n, got);
+            memcpy(msg, HKX2_SEG_DS, HKX2_SEG_DS_LEN); m = HKX2_SEG_DS_LEN;
+            memcpy(msg + m, nonce.b, 32); m += 32;
+            for (j = 0; j < 4; j++) msg[m++] = (uint8_t)(seg >> (24 - 8 * j));
+            for (j = 0; j < 8; j++) msg[m++] = (uint8_t)(idx >> (56 - 8 * j));
+            msg[m++] = (uint8_t)(i & 1);
+            memcpy(msg + m, whole, n); m += n;
+            for (j = 0; j < 32; j++) mac_iv[j] = mac_key.b[j] ^ _HFSCX256_IV[j];
+            hfscx_256(msg, m, mac_iv, ref);
+            ok_tag += memcmp(ref, got, 32) == 0;
+
+            hkx2_seg_tag(&pre, idx + 1, i & 1, whole, n, alt);
+            good &= memcmp(alt, got, 32) != 0;
+            hkx2_seg_tag(&pre, idx, !(i & 1), whole, n, alt);
+            good &= memcmp(alt, got, 32) != 0;
+            ok_bind += good;
+            explicit_bzero(&pre, sizeof pre);
+            if (g_time_limit > 0.0 && time_exceeded(&ts0)) { N = i + 1; break; }
+        }
+        printf("    n=%d  segmented==whole=%d/%d  midstate==one-shot=%d/%d  idx/final bound=%d/%d  [%s]\n\n",
+               N, ok_ks, N, ok_tag, N, ok_bind, N,
+               (ok_ks == N && ok_tag == N && ok_bind == N) ? "PASS" : "FAIL");
+    }
+
+    /* ------------------------------------------------------------------ */
+    /* Security test [58]: the pooled CTR keystream must be byte-identical */
+    /* to the serial one for every pool size and length (including ranges  */
+    /* shorter than the thread count), and par_pool_run must call each     */
+    /* worker index exactly once per run.                                  */
+    /* ------------------------------------------------------------------ */
+    {
+        int N = g_rounds > 0 ? g_rounds : 120;
+        int ok_ks = 0, ok_run = 0, i, t;
+        ParPool pools[6];
+        struct timespec ts0;
+        clock_gettime(CLOCK_MONOTONIC, &ts0);
+
+        printf("[58] ParPool CTR keystream: hske_nla1_xor_ks_par == serial for 1..6 threads  [HSKE]\n");
+
+        for (t = 0; t < 6; t++) par_pool_init(&pools[t], t + 1);
+        for (i = 0; i < N; i++) {
+            uint8_t pt[1000], ref[1000], got[1000];
+            size_t len = (size_t)((i * 37) % 1001);
+            uint32_t blk0 = (uint32_t)i * 131u;
+            BitArray K, nonce, base, seed;
+            int good_ks = 1, good_run = 1;
+            ba_rand(&K, urnd_fp); ba_rand(&nonce, urnd_fp);
+            if (fread(pt, 1, sizeof pt, urnd_fp) != sizeof pt) exit(1);
+            ba_xor(&base, &K, &nonce);
+            ba_rnl_kdf_seed(&seed, &base);
+            hske_nla1_xor_ks(&seed, &base, blk0, pt, len, ref);
+            for (t = 0; t < 6; t++) {
+                int hits[6] = {0}, k;
+                memset(got, 0, sizeof got);
+                hske_nla1_xor_ks_par(&pools[t], &seed, &base, blk0, pt, len, got);
+                good_ks &= len == 0 || memcmp(ref, got, len) == 0;
+                par_pool_run(&pools[t], _test_par_count, hits);
+                for (k = 0; k < 6; k++) good_run &= hits[k] == (k < pools[t].n);
+            }
+            ok_ks += good_ks;
+            ok_run += good_run;
+            if (g_time_limit > 0.0 && time_exceeded(&ts0)) { N = i + 1; break; }
+        }
+        for (t = 0; t < 6; t++) par_pool_free(&pools[t]);
+        printf("    n=%d  par==serial=%d/%d  each worker once=%d/%d  [%s]\n\n",
+               N, ok_ks, N, ok_run, N, (ok_ks == N && ok_run == N) ? "PASS" : "FAIL");
+    }
+
+    /* ------------------------------------------------------------------ */
+    /* Security test [59]: a batch of HKX2 segments sealed on a pool must  */
+    /* match hske_nla1_xor_ks + hkx2_seg_tag applied one segment at a      */
+    /* time, for pools larger and smaller than the batch.  Opening must    */
+    /* restore the plaintext, and after one ciphertext byte is flipped it  */
+    /* must report exactly the segments before the tampered one as good.   */
+    /* ------------------------------------------------------------------ */
+    {
+        int N = g_rounds > 0 ? g_rounds : 100;
+        int ok_seal = 0, ok_open = 0, ok_tamper = 0, i, t;
+        ParPool pools[4];
+        struct timespec ts0;
+        clock_gettime(CLOCK_MONOTONIC, &ts0);
+
+        printf("[59] HKX2 batches: hkx2_seal_batch == per-segment seal, open stops at first bad segment  [HSKE]\n");
+
+        for (t = 0; t < 4; t++) par_pool_init(&pools[t], t + 1);
+        for (i = 0; i < N; i++) {
+            enum { SEG = 64, MAXC = 5 };
+            uint8_t pt[MAXC * SEG], ref[MAXC * SEG], reft[MAXC * 32];
+            uint8_t sb[MAXC * SEG], tags[MAXC * 32], rec[MAXC * (SEG + 32)], ok[MAXC];
+            size_t cnt = 1 + (size_t)(i % MAXC), last = (size_t)(i * 7) % (SEG + 1), k, bad;
+            uint64_t idx0 = (uint64_t)i * 3u;
+            BitArray K, nonce, base, seed, mac_key;
+            HfscxCtx pre;
+            Hkx2Batch bt;
+            int good_seal = 1, good_open = 1, good_tamper = 1;
+            if (cnt == 1 && last == 0 && i % 2) last = SEG;
+            ba_rand(&K, urnd_fp); ba_rand(&nonce, urnd_fp);
+            if (fread(pt, 1, sizeof pt, urnd_fp) != sizeof pt) exit(1);
+            ba_xor(&base, &K, &nonce);
+            ba_rnl_kdf_seed(&seed, &base);
+            hske_nla1_mac_key(&seed, &base, &mac_key);
+            hkx2_tag_init(&pre, &mac_key, &nonce, SEG);
+
+            for (k = 0; k < cnt; k++) {
+                size_t len = k + 1 == cnt ? last : SEG;
+                hske_nla1_xor_ks(&seed, &base, (uint32_t)((idx0 + k) * (SEG / KEYBYTES)),
+                                 pt + k * SEG, len, ref + k * SEG);
+                hkx2_seg_tag(&pre, idx0 + k, (i & 1) && k + 1 == cnt,
+                             ref + k * SEG, len, reft + 32 * k);
+            }
+            for (t = 0; t < 4; t++) {
+                memset(&bt, 0, sizeof bt);
+                bt.seed = &seed; bt.base = &base; bt.pre = &pre; bt.seg = SEG;
+                bt.idx0 = idx0; bt.cnt = cnt; bt.last_len = last; bt.final = i & 1;
+                memcpy(sb, pt, sizeof sb);
+                bt.buf = sb; bt.stride = SEG; bt.tags = tags;
+                hkx2_seal_batch(&pools[t], &bt);
+                good_seal &= memcmp(sb, ref, (cnt - 1) * SEG + last) == 0
+                          && memcmp(tags, reft, 32 * cnt) == 0;
+
+                for (k = 0; k < cnt; k++) {
+                    size_t len = k + 1 == cnt ? last : SEG;
+                    memcpy(rec + k * (SEG + 32), ref + k * SEG, len);
+                    memcpy(rec + k * (SEG + 32) + len, reft + 32 * k, 32);
+                }
+                bt.buf = rec; bt.stride = SEG + 32; bt.tags = NULL; bt.ok = ok;
+                good_open &= hkx2_open_batch(&pools[t], &bt) == cnt;
+                for (k = 0; k < cnt; k++)
+                    good_open &= memcmp(rec + k * (SEG + 32), pt + k * SEG,
+                                        k + 1 == cnt ? last : SEG) == 0;
+
+                bad = (size_t)i % cnt;
+                for (k = 0; k < cnt; k++) {
+                    size_t len = k + 1 == cnt ? last : SEG;
+                    memcpy(rec + k * (SEG + 32), ref + k * SEG, len);
+                    memcpy(rec + k * (SEG + 32) + len, reft + 32 * k, 32);
+                }
+                rec[bad * (SEG + 32)] ^= 0x01;  /* ct byte, or tag byte if empty */
+                good_tamper &= hkx2_open_batch(&pools[t], &bt) == bad;
+            }
+            ok_seal += good_seal;
+            ok_open += good_open;
+            ok_tamper += good_tamper;
+            explicit_bzero(&pre, sizeof pre);
+            if (g_time_limit > 0.0 && time_exceeded(&ts0)) { N = i + 1; break; }
+        }
+        for (t = 0; t < 4; t++) par_pool_free(&pools[t]);
+        printf("    n=%d  batch==per-segment=%d/%d  open round-trip=%d/%d  first-bad=%d/%d  [%s]\n\n",
+               N, ok_seal, N, ok_open, N, ok_tamper, N,
+               (ok_seal == N && ok_open == N && ok_tamper == N) ? "PASS" : "FAIL");
+    }
+
+    /* ------------------------------------------------------------------ */
+    /* Security test [60]: hske_nla1_xor_ks advances up to eight counter   */
+    /* blocks in lockstep; under both lane backends it must equal the      */
+    /* per-block hske_nla1_ks_block stream for any length and start        */
+    /* counter (including uint32 wrap), and HSKE-NL-AEAD built on it must  */
+    /* round-trip.                                                         */
+    /* ------------------------------------------------------------------ */
+    {
+        int N = g_rounds > 0 ? g_rounds : 300;
+        int ok_ks = 0, ok_aead = 0, i;
+        const char *backend;
+        void (*saved)(BaWords *, const BaWords *, int, int);
+        struct timespec ts0;
+        clock_gettime(CLOCK_MONOTONIC, &ts0);
+
+        hfscx_mb_dispatch_init();
+        saved = _nl_v1_revolve_mb;
+        backend = saved == _nl_v1_revolve_mb_soft ? "portable" : "avx2";
+        printf("[60] HSKE-NL-A1 lane keystream (both backends) == per-block, AEAD round-trip  [HSKE]\n");
+
+        for (i = 0; i < N; i++) {
+            static uint8_t pt[600], ct[600], ref[600], dec[600];
+            BitArray K, Nn, seed, base, ks;
+            uint8_t tag[32], ad[7];
+            size_t len = (size_t)((i * 53) % 600), off, j;
+            uint32_t blk0 = (i & 3) == 3 ? 0xFFFFFFFCu : (uint32_t)i * 5u;
+            int pass, good = 1;
+            ba_rand(&K, urnd_fp); ba_rand(&Nn, urnd_fp);
+            if (fread(pt, 1, sizeof pt, urnd_fp) != sizeof pt ||
+                fread(ad, 1, sizeof ad, urnd_fp) != sizeof ad) { fprintf(stderr, "urandom read\n"); exit(1); }
+            ba_xor(&base, &K, &Nn);
+            ba_rnl_kdf_seed(&seed, &base);
+            for (off = 0; off < len; off += KEYBYTES) {
+                hske_nla1_ks_block(&seed, &base, blk0 + (uint32_t)(off / KEYBYTES), &ks);
+                for (j = 0; j < KEYBYTES && off + j < len; j++) ref[off + j] = pt[off + j] ^ ks.b[j];
+            }
+            for (pass = 0; pass < 2; pass++) {
+                _nl_v1_revolve_mb = pass ? _nl_v1_revolve_mb_soft : saved;
+                hske_nla1_xor_ks(&seed, &base, blk0, pt, len, ct);
+                good &= memcmp(ct, ref, len) == 0;
+            }
+            _nl_v1_revolve_mb = saved;
+            ok_ks += good;
+
+            hske_nl_aead_encrypt(&K, &Nn, ad, sizeof ad, pt, len, ct, tag);
+            good = hske_nl_aead_decrypt(&K, &Nn, ad, sizeof ad, ct, len, tag, dec) &&
+                   memcmp(dec, pt, len) == 0;
+            if (len) {
+                ct[len / 2] ^= 0x80;
+                good &= !hske_nl_aead_decrypt(&K, &Nn, ad, sizeof ad, ct, len, tag, dec);
+            }
+            ok_aead += good;
+            if (g_time_limit > 0.0 && time_exceeded(&ts0)) { N = i + 1; break; }
+        }
+        printf("    n=%d  backend=%s  lanes==per-block=%d/%d  aead round-trip/tamper=%d/%d  [%s]\n\n",
+               N, backend, ok_ks, N, ok_aead, N,
+               (ok_ks == N && ok_aead == N) ? "PASS" : "FAIL");
+    }
+
+    bench_hske_nl_aead();
+
+    /* ------------------------------------------------------------------ */
+    /* Security test [62]: the streaming duplex (HskeDuplexCtx) fed in     */
+    /* random pieces must give the one-shot ciphertext and tag; streaming  */
+    /* decrypt must recover the plaintext and accept the tag, and a        */
+    /* flipped ciphertext or AD byte must fail with pt_out zeroed.         */
+    /* ------------------------------------------------------------------ */
+    {
+        int N = g_rounds > 0 ? g_rounds : 300;
+        int ok_enc = 0, ok_dec = 0, ok_rej = 0, i;
+        struct timespec ts0;
+        clock_gettime(CLOCK_MONOTONIC, &ts0);
+        printf("[62] Streaming HSKE-NL-V2-Duplex == one-shot for any split, tamper rejection  [HSKE]\n");
+
+        for (i = 0; i < N; i++) {
+            static uint8_t pt[300], ct[300], cts[300], dec[300];
+            uint8_t ad[40], tag[32], tags[32];
+            BitArray K, Nn;
+            HskeDuplexCtx c;
+            size_t len = (size_t)((i * 41) % 300), ad_len = (size_t)(i % 40), off, n;
+            int good, z;
+            ba_rand(&K, urnd_fp); ba_rand(&Nn, urnd_fp);
+            if (fread(pt, 1, sizeof pt, urnd_fp) != sizeof pt ||
+                fread(ad, 1, sizeof ad, urnd_fp) != sizeof ad) { fprintf(stderr, "urandom read\n"); exit(1); }
+            hske_nl_v2_duplex_encrypt(&K, &Nn, ad, ad_len, pt, len, ct, tag);
+
+            hske_nl_v2_duplex_init(&c, &K, &Nn);
+            hske_nl_v2_duplex_absorb_ad(&c, ad, ad_len);
+            for (off = 0; off < len; off += n) {
+                n = 1 + (size_t)rand32() % 40;
+                if (n > len - off) n = len - off;
+                hske_nl_v2_duplex_encrypt_update(&c, pt + off, n, cts + off);
+            }
+            hske_nl_v2_duplex_encrypt_final(&c, tags);
+            ok_enc += memcmp(cts, ct, len) == 0 && memcmp(tags, tag, 32) == 0;
+
+            hske_nl_v2_duplex_init(&c, &K, &Nn);
+            hske_nl_v2_duplex_absorb_ad(&c, ad, ad_len);
+            for (off = 0; off < len; off += n) {
+                n = 1 + (size_t)rand32() % 40;
+                if (n > len - off) n = len - off;
+                hske_nl_v2_duplex_decrypt_update(&c, ct + off, n, dec + off);
+            }
+            good = hske_nl_v2_duplex_decrypt_final(&c, tag) && memcmp(dec, pt, len) == 0;
+            good &= hske_nl_v2_duplex_decrypt(&K, &Nn, ad, ad_len, ct, len, tag, dec) &&
+                    memcmp(dec, pt, len) == 0;
+            ok_dec += good;
+
+            if (len) ct[i % len] ^= 0x01; else ad[0] ^= 0x01;
+            if (!len && !ad_len) tag[0] ^= 0x01;
+            good = !hske_nl_v2_duplex_decrypt(&K, &Nn, ad, ad_len, ct, len, tag, dec);
+            for (z = 0; z < (int)len; z++) good &= dec[z] == 0;
+            ok_rej += good;
+            if (g_time_limit > 0.0 && time_exceeded(&ts0)) { N = i + 1; break; }
+        }
+        printf("    n=%d  stream enc==one-shot=%d/%d  stream/one-shot dec=%d/%d  tamper rejected=%d/%d  [%s]\n\n",
+               N, ok_enc, N, ok_dec, N, ok_rej, N,
+               (ok_enc == N && ok_dec == N && ok_rej == N) ? "PASS" : "FAIL");
+    }
+
+    bench_hske_duplex();
+
+    /* ------------------------------------------------------------------ */
+    /* Security test [64]: drbg_generate_bulk must equal its definition    */
+    /* (HSKE-NL-A1 keystream under HFSCX-256(state||blocks||"DRBG-REQ"),   */
+    /* one state ratchet per request), respect DRBG_MAX_BLOCKS, and        */
+    /* HDrbgBuf reads of any small split must replay the batch stream.     */
+    /* Reports per-block vs bulk generation throughput.                    */
+    /* ------------------------------------------------------------------ */
+    {
+        int N = g_rounds > 0 ? g_rounds : 300;
+        int ok_def = 0, ok_buf = 0, ok_lim, i;
+        static uint8_t out[5000], ref[3 * HDRBG_BUF_BYTES], got[3 * HDRBG_BUF_BYTES];
+        struct timespec ts0, t0, t1;
+        double secs[2];
+        long long bytes[2];
+        int mode;
+        clock_gettime(CLOCK_MONOTONIC, &ts0);
+        printf("[64] HDRBG bulk mode == definition, one ratchet per request, buffered reads  [HDRBG]\n");
+
+        for (i = 0; i < N; i++) {
+            HDrbg d, e;
+            HDrbgBuf b;
+            BitArray dom, key, seed, next;
+            uint8_t ent[48], buf[KEYBYTES + 8 + 8];
+            size_t len = (size_t)((i * 97) % sizeof out), off, n, j;
+            int good = 1;
+            if (fread(ent, 1, sizeof ent, urnd_fp) != sizeof ent) { fprintf(stderr, "urandom read\n"); exit(1); }
+            drbg_seed(&d, ent, sizeof ent, (const uint8_t *)"t64", 3);
+            d.blocks = (uint64_t)i;
+            e = d;
+            good &= drbg_generate_bulk(&d, out, len);
+            memcpy(buf, e.state.b, KEYBYTES);
+            _drbg_be64(buf + KEYBYTES, e.blocks);
+            memcpy(buf + KEYBYTES + 8, "DRBG-REQ", 8);
+            hfscx_256(buf, KEYBYTES + 16, NULL, key.b);
+            ba_rnl_kdf_seed(&seed, &key);
+            for (off = 0; off < len; off += KEYBYTES) {
+                BitArray ks;
+                hske_nla1_ks_block(&seed, &key, (uint32_t)(off / KEYBYTES), &ks);
+                for (j = 0; j < KEYBYTES && off + j < len; j++) good &= out[off + j] == ks.b[j];
+            }
+            memcpy(dom.b, _DRBG_DOMAIN_BYTES, KEYBYTES);
+            nl_fscx_revolve_v1_ba(&next, &e.state, &dom, I_VALUE);
+            good &= ba_equal(&d.state, &next) &&
+                    d.blocks == e.blocks + (len + KEYBYTES - 1) / KEYBYTES;
+            ok_def += good;
+
+            /* Three batches, read back in pieces of 1..300 bytes. */
+            e.blocks = 0; d = e;
+            for (j = 0; j < 3; j++) drbg_generate_bulk(&d, ref + j * HDRBG_BUF_BYTES, HDRBG_BUF_BYTES);
+            drbg_buf_init(&b, &e);
+            for (off = 0; off < sizeof got; off += n) {
+                n = 1 + (size_t)rand32() % 300;
+                if (n > sizeof got - off) n = sizeof got - off;
+                good &= drbg_buf_read(&b, got + off, n);
+            }
+            ok_buf += good && memcmp(got, ref, sizeof got) == 0 && ba_equal(&b.d.state, &d.state);
+            if (g_time_limit > 0.0 && time_exceeded(&ts0)) { N = i + 1; break; }
+        }
+        {
+            HDrbg d;
+            uint8_t ent[32] = {1};
+            drbg_seed(&d, ent, sizeof ent, NULL, 0);
+            d.blocks = DRBG_MAX_BLOCKS - 1;
+            ok_lim = !drbg_generate_bulk(&d, out, 2 * KEYBYTES) && d.blocks == DRBG_MAX_BLOCKS - 1 &&
+                     drbg_generate_bulk(&d, out, KEYBYTES) && !drbg_generate_bulk(&d, out, 1);
+        }
+        for (mode = 0; mode < 2; mode++) {
+            static uint8_t big[65536];
+            HDrbg d;
+            uint8_t ent[32] = {2};
+            drbg_seed(&d, ent, sizeof ent, NULL, 0);
+            bytes[mode] = 0;
+            clock_gettime(CLOCK_MONOTONIC, &t0);
+            do {
+                if (d.blocks + sizeof big / KEYBYTES > DRBG_MAX_BLOCKS) d.blocks = 0;
+                if (mode) drbg_generate_bulk(&d, big, sizeof big);
+                else drbg_generate(&d, big, sizeof big);
+                bytes[mode] += (long long)sizeof big;
+                clock_gettime(CLOCK_MONOTONIC, &t1);
+            } while ((secs[mode] = elapsed_sec(&t0, &t1)) < g_bench_sec / 2);
+        }
+        printf("    n=%d  bulk==definition=%d/%d  buffered==batches=%d/%d  block limit=%s  [%s]\n",
+               N, ok_def, N, ok_buf, N, ok_lim ? "ok" : "BAD",
+               (ok_def == N && ok_buf == N && ok_lim) ? "PASS" : "FAIL");
+        printf("    per-block %.2f MB/s   bulk %.2f MB/s  (64 KiB requests)\n\n",
+               (double)bytes[0] / secs[0] / 1.0e6, (double)bytes[1] / secs[1] / 1.0e6);
+    }
+
+    /* [65] Entropy source: the buffered OS path hands out every byte once
+       (split reads of 1..300 bytes and reads past HRAND_BUF_BYTES), wipes what
+       it has handed out, and never repeats the parent's buffer in a forked
+       child; a FILE* still reads through fread.  Then the 1- and 3-byte
+       rejection samplers are timed from /dev/urandom vs HERRADURA_OS_RNG. */
+    {
+        static uint8_t big[3 * HRAND_BUF_BYTES + 17];
+        int N = g_rounds > 0 ? g_rounds : 300, i, mode;
+        int ok_split = 0, ok_wipe = 0, ok_file = 0, ok_fork = 0;
+        long ones = 0, nbits = 0;
+        double secs[2];
+        long long polys[2];
+        struct timespec ts0, t0, t1;
+        clock_gettime(CLOCK_MONOTONIC, &ts0);
+        printf("[65] Entropy source: OS buffer split/large reads, wipe, fork, FILE* adapter  [RNG]\n");
+
+        for (i = 0; i < N; i++) {
+            uint8_t a[KEYBYTES], b[KEYBYTES];
+            size_t off, n, j;
+            int good = 1;
+            for (off = 0; off < sizeof big; off += n) {
+                n = (i & 1) ? 1 + (size_t)rand32() % 300 : sizeof big;
+                if (n > sizeof big - off) n = sizeof big - off;
+                good &= urnd_read(HERRADURA_OS_RNG, big + off, n);
+            }
+            for (j = 0; j < sizeof big; j++) ones += __builtin_popcount(big[j]);
+            nbits += 8 * (long)sizeof big;
+            good &= urnd_read(HERRADURA_OS_RNG, a, sizeof a) && urnd_read(HERRADURA_OS_RNG, b, sizeof b) &&
+                    memcmp(a, b, sizeof a) != 0;
+            ok_split += good;
+            {
+                size_t p = _hrand_tls.pos, z = 0;
+                for (j = 0; j < p; j++) z += _hrand_tls.buf[j] == 0;
+                ok_wipe += p > 0 && p <= HRAND_BUF_BYTES && z == p;
+            }
+            ok_file += urnd_read(urnd_fp, a, sizeof a) && urnd_read(urnd_fp, b, sizeof b) &&
+                       memcmp(a, b, sizeof a) != 0;
+            if (g_time_limit > 0.0 && time_exceeded(&ts0)) { N = i + 1; break; }
+        }
+        {
+            /* Parent and child each draw right after fork(); the child must
+               refill from the OS instead of replaying the inherited buffer. */
+            uint8_t warm[1], pa[KEYBYTES], ch[KEYBYTES];
+            int fd[2], st;
+            pid_t pid;
+            urnd_read(HERRADURA_OS_RNG, warm, 1);
+            if (pipe(fd) == 0 && (pid = fork()) >= 0) {
+                if (pid == 0) {
+                    close(fd[0]);
+                    if (urnd_read(HERRADURA_OS_RNG, ch, sizeof ch) &&
+                        write(fd[1], ch, sizeof ch) == (ssize_t)sizeof ch) _exit(0);
+                    _exit(1);
+                }
+                close(fd[1]);
+                ok_fork = urnd_read(HERRADURA_OS_RNG, pa, sizeof pa) &&
+                          read(fd[0], ch, sizeof ch) == (ssize_t)sizeof ch &&
+                          waitpid(pid, &st, 0) == pid && WIFEXITED(st) && WEXITSTATUS(st) == 0 &&
+                          memcmp(pa, ch, sizeof pa) != 0;
+                close(fd[0]);
+            }
+        }
+        for (mode = 0; mode < 2; mode++) {
+            FILE *src = mode ? HERRADURA_OS_RNG : urnd_fp;
+            rnl_poly_t p;
+            BitArray e;
+            polys[mode] = 0;
+            clock_gettime(CLOCK_MONOTONIC, &t0);
+            do {
+                rnl_rand_poly(p, src);
+                stern_rand_error(&e, src);
+                polys[mode]++;
+                clock_gettime(CLOCK_MONOTONIC, &t1);
+            } while ((secs[mode] = elapsed_sec(&t0, &t1)) < g_bench_sec / 2);
+        }
+        {
+            double frac = (double)ones / (double)nbits;
+            int ok_bias = frac > 0.49 && frac < 0.51;
+            printf("    n=%d  split/large reads=%d/%d  wiped=%d/%d  FILE*=%d/%d  fork=%s  ones=%.4f  [%s]\n",
+                   N, ok_split, N, ok_wipe, N, ok_file, N, ok_fork ? "ok" : "BAD", frac,
+                   (ok_split == N && ok_wipe == N && ok_file == N && ok_fork && ok_bias) ? "PASS" : "FAIL");
+        }
+        printf("    rnl_rand_poly+stern_rand_error: FILE* %.0f/s   OS buffer %.0f/s\n\n",
+               (double)polys[0] / secs[0], (double)polys[1] / secs[1]);
+    }
+
+    /* [66] rnl_poly_mul_dim (merged-twist NTT, lazy Fermat reduction) against
+       the original twist / %-reduced NTT / untwist pipeline, rnl_poly_mul_n.
+       Inputs are canonical, CBD-style {q-1,0,1}, or arbitrary int32 bit
+       patterns, which both must read as uint32 mod q. */
+    {
+        static int32_t f[RNL_N], g[RNL_N], h[RNL_N], r[RNL_N];
+        int N = g_rounds > 0 ? g_rounds : 200, i, j, mode, ok[2] = {0, 0};
+        const int dims[2] = { RNL_N, RNL_ALT_N };
+        double secs[2];
+        long long muls[2];
+        struct timespec ts0, t0, t1;
+        clock_gettime(CLOCK_MONOTONIC, &ts0);
+        printf("[66] Lazy-reduction negacyclic NTT == reference multiply, n=1024 and n=256  [PQC]\n");
+
+        for (i = 0; i < N; i++) {
+            for (mode = 0; mode < 2; mode++) {
+                int n = dims[mode], kind = i % 3;
+                for (j = 0; j < n; j++) {
+                    f[j] = kind == 0 ? (int32_t)rnl_rand_coeff() :
+                           kind == 1 ? (int32_t)((rand32() % 3 + RNL_Q - 1) % RNL_Q) : (int32_t)rand32();
+                    g[j] = kind == 2 ? (int32_t)rand32() : (int32_t)rnl_rand_coeff();
+                }
+                rnl_poly_mul_dim(h, f, g, n);
+                rnl_poly_mul_n(r, f, g, n);
+                ok[mode] += memcmp(h, r, (size_t)n * sizeof h[0]) == 0;
+            }
+            if (g_time_limit > 0.0 && time_exceeded(&ts0)) { N = i + 1; break; }
+        }
+        for (mode = 0; mode < 2; mode++) {
+            muls[mode] = 0;
+            clock_gettime(CLOCK_MONOTONIC, &t0);
+            do {
+                if (mode) rnl_poly_mul_dim(h, f, g, RNL_N);
+                else rnl_poly_mul_n(h, f, g, RNL_N);
+                muls[mode]++;
+                clock_gettime(CLOCK_MONOTONIC, &t1);
+            } while ((secs[mode] = elapsed_sec(&t0, &t1)) < g_bench_sec / 2);
+        }
+        printf("    n=%d  n=1024 match=%d/%d  n=256 match=%d/%d  [%s]\n",
+               N, ok[0], N, ok[1], N, (ok[0] == N && ok[1] == N) ? "PASS" : "FAIL");
+        printf("    n=1024 multiply: reference %.0f/s   lazy NTT %.0f/s  (%.2fx)\n\n",
+               (double)muls[0] / secs[0], (double)muls[1] / secs[1],
+               ((double)muls[1] / secs[1]) / ((double)muls[0] / secs[0]));
+    }
+
+    /* [67] The RNL kernels rnl_twiddle_init selected (AVX2 where available)
+       against the portable ones: poly multiply at both ring dimensions,
+       round_p / lift_q over in-range, out-of-range and negative inputs with
+       ragged lengths, and a full HKEX-RNL agree, which must give the same
+       key and hint under either backend.  Then handshakes/s per backend. */
+    {
+        static int32_t f[RNL_N], g[RNL_N], h[RNL_N], r[RNL_N];
+        void (*mul_sel)(int32_t *, const int32_t *, const int32_t *, int, uint32_t);
+        void (*round_sel)(int32_t *, const int32_t *, int), (*lift_sel)(int32_t *, const int32_t *, int);
+        const char *backend;
+        int N = g_rounds > 0 ? g_rounds : 200, i, j, mode, ok_mul = 0, ok_rl = 0, ok_kex = 0;
+        double secs[2];
+        long long hs[2];
+        struct timespec ts0, t0, t1;
+        clock_gettime(CLOCK_MONOTONIC, &ts0);
+
+        rnl_twiddle_init();
+        mul_sel = _rnl_poly_mul_kern; round_sel = _rnl_round_qp; lift_sel = _rnl_lift_pq;
+        backend = mul_sel == _rnl_poly_mul_soft ? "portable" : "avx2";
+        printf("[67] RNL SIMD backend == portable: poly mul, round/lift, HKEX-RNL agree  [PQC]\n");
+
+        for (i = 0; i < N; i++) {
+            int n = (i & 1) ? RNL_ALT_N : RNL_N, m = RNL_N - i % 13, good = 1;
+            rnl_poly_t m_blind, a_rand, s_a, c_a, s_b, c_b;
+            BitArray k_sel, k_ref, k_b;
+            uint8_t hint_sel[RNL_N / 8], hint_ref[RNL_N / 8];
+            for (j = 0; j < n; j++) {
+                f[j] = (i % 3 == 2) ? (int32_t)rand32() : (int32_t)rnl_rand_coeff();
+                g[j] = (i % 3 == 0) ? (int32_t)((rand32() % 3 + RNL_Q - 1) % RNL_Q) : (int32_t)rand32();
+            }
+            mul_sel(h, f, g, n, n == RNL_N ? rnl_tw.inv_n : rnl_tw_alt.inv_n);
+            _rnl_poly_mul_soft(r, f, g, n, n == RNL_N ? rnl_tw.inv_n : rnl_tw_alt.inv_n);
+            ok_mul += memcmp(h, r, (size_t)n * sizeof h[0]) == 0;
+
+            for (j = 0; j < m; j++)
+                f[j] = (i % 4 == 0) ? (int32_t)rand32() : (i % 4 == 1) ? (int32_t)(rand32() % (1u << 20)) - 4096
+                                                                       : (int32_t)(rand32() % RNL_Q);
+            round_sel(h, f, m); _rnl_round_qp_soft(r, f, m);
+            good &= memcmp(h, r, (size_t)m * sizeof h[0]) == 0;
+            for (j = 0; j < m; j++) f[j] = (i % 4 == 1) ? f[j] % (1 << 15) : (int32_t)(rand32() % RNL_P);
+            lift_sel(h, f, m); _rnl_lift_pq_soft(r, f, m);
+            ok_rl += good && memcmp(h, r, (size_t)m * sizeof h[0]) == 0;
+
+            rnl_m_poly(m_blind);
+            rnl_rand_poly(a_rand, urnd_fp);
+            rnl_poly_add(m_blind, m_blind, a_rand);
+            rnl_keygen(s_a, c_a, m_blind, urnd_fp);
+            rnl_keygen(s_b, c_b, m_blind, urnd_fp);
+            rnl_agree(&k_sel, s_a, c_b, NULL, hint_sel);
+            rnl_agree(&k_b, s_b, c_a, hint_sel, NULL);
+            _rnl_poly_mul_kern = _rnl_poly_mul_soft; _rnl_round_qp = _rnl_round_qp_soft; _rnl_lift_pq = _rnl_lift_pq_soft;
+            rnl_agree(&k_ref, s_a, c_b, NULL, hint_ref);
+            _rnl_poly_mul_kern = mul_sel; _rnl_round_qp = round_sel; _rnl_lift_pq = lift_sel;
+            ok_kex += ba_equal(&k_sel, &k_ref) && ba_equal(&k_sel, &k_b) &&
+                      memcmp(hint_sel, hint_ref, sizeof hint_sel) == 0;
+            if (g_time_limit > 0.0 && time_exceeded(&ts0)) { N = i + 1; break; }
+        }
+        for (mode = 0; mode < 2; mode++) {
+            rnl_poly_t m_blind, s_a, c_a, s_b, c_b;
+            BitArray ka, kb;
+            uint8_t hint[RNL_N / 8];
+            if (!mode) { _rnl_poly_mul_kern = _rnl_poly_mul_soft; _rnl_round_qp = _rnl_round_qp_soft; _rnl_lift_pq = _rnl_lift_pq_soft; }
+            rnl_m_poly(m_blind);
+            rnl_rand_poly(s_a, urnd_fp);
+            rnl_poly_add(m_blind, m_blind, s_a);
+            hs[mode] = 0;
+            clock_gettime(CLOCK_MONOTONIC, &t0);
+            do {
+                rnl_keygen(s_a, c_a, m_blind, HERRADURA_OS_RNG);
+                rnl_keygen(s_b, c_b, m_blind, HERRADURA_OS_RNG);
+                rnl_agree(&ka, s_a, c_b, NULL, hint);
+                rnl_agree(&kb, s_b, c_a, hint, NULL);
+                hs[mode]++;
+                clock_gettime(CLOCK_MONOTONIC, &t1);
+            } while ((secs[mode] = elapsed_sec(&t0, &t1)) < g_bench_sec / 2);
+            _rnl_poly_mul_kern = mul_sel; _rnl_round_qp = round_sel; _rnl_lift_pq = lift_sel;
+        }
+        printf("    n=%d  backend=%s  poly mul=%d/%d  round/lift=%d/%d  agree=%d/%d  [%s]\n",
+               N, backend, ok_mul, N, ok_rl, N, ok_kex, N,
+               (ok_mul == N && ok_rl == N && ok_kex == N) ? "PASS" : "FAIL");
+        printf("    HKEX-RNL n=1024 handshake (2 keygen + 2 agree): portable %.0f/s   %s %.0f/s\n\n",
+               (double)hs[0] / secs[0], backend, (double)hs[1] / secs[1]);
+    }
+
     fclose(urnd_fp);
     return 0;
 }
@@ -544,7 +544,8 @@ int main(void)
                                             dplex_ad, ad_len,
                                             dplex_ct, pt_len,
                                             dplex_tag, dplex_rec);
-        /* tamper check: flip one ciphertext byte */
+        ok = ok && memcmp(dplex_rec, dplex_pt, pt_len) == 0;
+        /* tamper check: flip one ciphertext byte (dplex_rec is zeroed on failure) */
         uint8_t dplex_ct_bad[sizeof(dplex_pt) - 1];
         memcpy(dplex_ct_bad, dplex_ct, pt_len);
         dplex_ct_bad[0] ^= 1;
@@ -558,7 +559,7 @@ int main(void)
                                                 dplex_ad_bad, ad_len,
                                                 dplex_ct, pt_len,
                                                 dplex_tag, dplex_rec);
-        if (ok && memcmp(dplex_rec, dplex_pt, pt_len) == 0 && !bad_ct && !bad_ad)
+        if (ok && !bad_ct && !bad_ad)
             puts("- HSKE-NL-V2-Duplex round-trip + tamper/AD rejection correct [RESEARCH]");
         else
             puts("+ HSKE-NL-V2-Duplex FAILED!");
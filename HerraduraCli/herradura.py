@@ -163,9 +163,14 @@ _ZKP_NL_ALGOS      = {'hpks-zkp-nl'}
 _ZKP_CLI_ROUNDS    = _ZKP_NL_PROD_ROUNDS   # CLI default: full 128-bit soundness
 
 # Binary container format for encfile / decfile (.hkx files)
-_HKX_MAGIC     = b'HKX1'   # 4-byte magic
+_HKX_MAGIC     = b'HKX1'   # 4-byte magic (whole-file container)
+_HKX2_MAGIC    = b'HKX2'   # 4-byte magic (segmented container)
 _HKX_ALGO_NLA1 = 0x01      # algo byte: HSKE-NL-A1 CTR-mode AEAD
 _HKX_BLOCK     = 32        # cipher block = 256 bits
+_HKX2_HDR_LEN  = 41        # magic + algo + seg_size_be4 + nonce
+_HKX2_SEG_DS   = b'HKX2-SEG'
+_HKX2_SEG_DEF  = 65536     # default segment size
+_HKX2_SEG_MAX  = 1 << 24
 
 # ---------------------------------------------------------------------------
 # I/O helpers
@@ -2188,7 +2193,18 @@ def cmd_verify(args):
 # Sub-command: encfile   (HSKE-NL-A1 CTR-mode AEAD for arbitrary-size files)
 # ---------------------------------------------------------------------------
 #
-# Binary output format (.hkx):
+# encfile writes the segmented HKX2 container; decfile reads HKX2 and HKX1.
+#
+# HKX2 (.hkx), streamed one segment at a time:
+#   [0:4]        Magic b'HKX2'
+#   [4]          Algo byte: 0x01 = hske-nla1
+#   [5:9]        Segment size S (big-endian uint32; multiple of 32, <= 2^24)
+#   [9:41]       Nonce N_nonce (32 bytes)
+#   [41:]        Segments ct_i || tag_i; every ct_i but the last is S bytes,
+#                the last is 0..S bytes (empty file = one empty final segment)
+#   tag_i = HFSCX-256-MAC(mac_key, b'HKX2-SEG'||nonce||S_be4||i_be8||final||ct_i)
+#
+# HKX1 (.hkx), whole-file:
 #   [0:4]        Magic b'HKX1'
 #   [4]          Algo byte: 0x01 = hske-nla1
 #   [5:13]       Plaintext length (big-endian uint64)
@@ -2196,77 +2212,91 @@ def cmd_verify(args):
 #   [45:45+m*32] Ciphertext blocks (m = ceil(len/32); last block zero-padded)
 #   [45+m*32:]   Auth tag — HFSCX-256-MAC(mac_key, nonce||len||ciphertext)
 #
-# Keystream:  ks_i = nl_fscx_revolve_v1(seed, base XOR i, n/4)
+# Keystream:  ks_i = nl_fscx_revolve_v1(seed, base XOR i, n/4)  (i = global block)
 # MAC key:    nl_fscx_revolve_v1(ROL(seed, n/4), base, n/4)  [domain-separated]
 
-def cmd_encfile(args):
-    algo = args.algo
-    if algo != 'hske-nla1':
-        sys.exit(f"encfile: unsupported algorithm {algo!r}")
-
-    key_int, nbits = _load_key(args.key)
-    if nbits != 256:
-        sys.exit(f"encfile: key must be 256-bit; got {nbits}-bit")
-
-    plaintext     = _read_file(getattr(args, 'in'))
-    plaintext_len = len(plaintext)
-
+def _hkx_schedule(key_int, nonce_int):
+    """Return (base, seed, mac_iv) for one (key, nonce) pair."""
     n        = 256
-    blen     = _HKX_BLOCK          # 32 bytes
-    steps    = n // 4              # 64 NL-FSCX v1 steps per block
     iv_const = int.from_bytes(_HFSCX256_IV_BYTES, 'big')
+    base     = BitArray(n, key_int ^ nonce_int)
+    seed     = BitArray(n, base.rotated(n // 8).uint ^ (_RNL_KDF_DC_256 >> (256 - n)))
+    mac_key  = nl_fscx_revolve_v1(seed.rotated(n // 4), base, n // 4)
+    return base, seed, BitArray(n, mac_key.uint ^ iv_const)
 
-    K       = BitArray(n, key_int)
-    N_nonce = BitArray.random(n)
-    base    = BitArray(n, K.uint ^ N_nonce.uint)
-    seed    = BitArray(n, base.rotated(n // 8).uint ^ (_RNL_KDF_DC_256 >> (256 - n)))
-
-    # Encrypt: ks_i = nl_fscx_revolve_v1(seed, base XOR i, 64); C_i = P_i XOR ks_i
-    n_blocks  = (plaintext_len + blen - 1) // blen   # 0 for empty plaintext
-    ct_blocks = bytearray()
-    for i in range(n_blocks):
-        chunk = plaintext[i * blen:(i + 1) * blen]
-        p_blk = chunk + b'\x00' * (blen - len(chunk))   # zero-pad final block
-        ks    = nl_fscx_revolve_v1(seed, BitArray(n, base.uint ^ i), steps)
-        ct_blocks += bytes(p ^ k for p, k in zip(p_blk, ks.uint.to_bytes(blen, 'big')))
-
-    # MAC key: domain-separated from encryption (second ROL shift)
-    mac_key = nl_fscx_revolve_v1(seed.rotated(n // 4), base, steps)
-    mac_iv  = BitArray(n, mac_key.uint ^ iv_const)
-
-    # Auth tag: HFSCX-256-MAC over nonce || plaintext_len || ciphertext
-    mac_data = (N_nonce.uint.to_bytes(blen, 'big')
-                + plaintext_len.to_bytes(8, 'big')
-                + bytes(ct_blocks))
-    tag = hfscx_256(mac_data, iv=mac_iv)
 
-    header = (_HKX_MAGIC
-              + bytes([_HKX_ALGO_NLA1])
-              + plaintext_len.to_bytes(8, 'big')
-              + N_nonce.uint.to_bytes(blen, 'big'))
-    _write_file(args.out, header + bytes(ct_blocks) + tag)
+def _hkx_xor_ks(seed, base, blk0, data):
+    """XOR the HSKE-NL-A1 keystream into data, starting at block counter blk0."""
+    n, blen = 256, _HKX_BLOCK
+    out = bytearray(len(data))
+    for off in range(0, len(data), blen):
+        ks = nl_fscx_revolve_v1(seed, BitArray(n, base.uint ^ (blk0 + off // blen)), n // 4)
+        kb = ks.uint.to_bytes(blen, 'big')
+        for j, c in enumerate(data[off:off + blen]):
+            out[off + j] = c ^ kb[j]
+    return bytes(out)
 
 
-# ---------------------------------------------------------------------------
-# Sub-command: decfile
-# ---------------------------------------------------------------------------
+def _hkx2_seg_tag(mac_iv, prefix, idx, final, ct):
+    return hfscx_256(prefix + idx.to_bytes(8, 'big') + bytes([1 if final else 0]) + ct,
+                     iv=mac_iv)
 
-def cmd_decfile(args):
+
+def cmd_encfile(args):
     algo = args.algo
     if algo != 'hske-nla1':
-        sys.exit(f"decfile: unsupported algorithm {algo!r}")
+        sys.exit(f"encfile: unsupported algorithm {algo!r}")
 
     key_int, nbits = _load_key(args.key)
     if nbits != 256:
-        sys.exit(f"decfile: key must be 256-bit; got {nbits}-bit")
+        sys.exit(f"encfile: key must be 256-bit; got {nbits}-bit")
+    seg = args.chunk
+    if seg < _HKX_BLOCK or seg > _HKX2_SEG_MAX or seg % _HKX_BLOCK:
+        sys.exit("encfile: --chunk must be a multiple of 32 between 32 and 16777216")
+
+    N_nonce            = BitArray.random(256)
+    nonce_bytes        = N_nonce.uint.to_bytes(_HKX_BLOCK, 'big')
+    base, seed, mac_iv = _hkx_schedule(key_int, N_nonce.uint)
+    prefix = _HKX2_SEG_DS + nonce_bytes + seg.to_bytes(4, 'big')
+
+    path = getattr(args, 'in')
+    fin  = sys.stdin.buffer if path == '-' else open(path, 'rb')
+    fout = sys.stdout.buffer if args.out == '-' else open(args.out, 'wb')
+    ok   = False
+    try:
+        fout.write(_HKX2_MAGIC + bytes([_HKX_ALGO_NLA1]) + seg.to_bytes(4, 'big')
+                   + nonce_bytes)
+        # Look one segment ahead so the last one is tagged final
+        cur, idx = fin.read(seg), 0
+        while True:
+            nxt   = fin.read(seg) if len(cur) == seg else b''
+            final = not nxt
+            blk0  = idx * (seg // _HKX_BLOCK)
+            if blk0 + (len(cur) + _HKX_BLOCK - 1) // _HKX_BLOCK > 1 << 32:
+                sys.exit("encfile: input exceeds the 128 GiB HKX2 limit")
+            ct = _hkx_xor_ks(seed, base, blk0, cur)
+            fout.write(ct + _hkx2_seg_tag(mac_iv, prefix, idx, final, ct))
+            if final:
+                break
+            cur, idx = nxt, idx + 1
+        ok = True
+    finally:
+        if fin is not sys.stdin.buffer:
+            fin.close()
+        if fout is not sys.stdout.buffer:
+            fout.close()
+            if not ok:
+                os.remove(args.out)
 
-    raw = _read_file(getattr(args, 'in'))
 
-    # Parse and validate header
+# ---------------------------------------------------------------------------
+# Sub-command: decfile
+# ---------------------------------------------------------------------------
+
+def _decfile_hkx1(key_int, raw):
+    """Verify-then-decrypt a whole-file HKX1 container."""
     if len(raw) < 77:   # 4+1+8+32+32 minimum (empty plaintext + tag)
         sys.exit("decfile: file too short to be a valid .hkx container")
-    if raw[:4] != _HKX_MAGIC:
-        sys.exit(f"decfile: invalid magic {raw[:4]!r} (expected {_HKX_MAGIC!r})")
     if raw[4] != _HKX_ALGO_NLA1:
         sys.exit(f"decfile: unsupported algo byte 0x{raw[4]:02x}")
 
@@ -2281,19 +2311,9 @@ def cmd_decfile(args):
     ct_bytes   = raw[45:ct_end]
     tag_stored = bytes(raw[ct_end:ct_end + 32])
 
-    n        = 256
-    blen     = _HKX_BLOCK
-    steps    = n // 4
-    iv_const = int.from_bytes(_HFSCX256_IV_BYTES, 'big')
-
-    K       = BitArray(n, key_int)
-    N_nonce = BitArray(n, int.from_bytes(nonce_bytes, 'big'))
-    base    = BitArray(n, K.uint ^ N_nonce.uint)
-    seed    = BitArray(n, base.rotated(n // 8).uint ^ (_RNL_KDF_DC_256 >> (256 - n)))
+    base, seed, mac_iv = _hkx_schedule(key_int, int.from_bytes(nonce_bytes, 'big'))
 
     # Recompute auth tag and compare before decrypting (verify-then-decrypt)
-    mac_key = nl_fscx_revolve_v1(seed.rotated(n // 4), base, steps)
-    mac_iv  = BitArray(n, mac_key.uint ^ iv_const)
     mac_data = (nonce_bytes
                 + plaintext_len.to_bytes(8, 'big')
                 + bytes(ct_bytes))
@@ -2302,14 +2322,72 @@ def cmd_decfile(args):
     if not _hmac.compare_digest(tag_stored, tag_computed):
         sys.exit("decfile: authentication tag mismatch — file corrupt or wrong key")
 
-    # Decrypt and trim to exact plaintext length
-    plaintext = bytearray()
-    for i in range(n_blocks):
-        c_blk = ct_bytes[i * blen:(i + 1) * blen]
-        ks    = nl_fscx_revolve_v1(seed, BitArray(n, base.uint ^ i), steps)
-        plaintext += bytes(c ^ k for c, k in zip(c_blk, ks.uint.to_bytes(blen, 'big')))
+    return _hkx_xor_ks(seed, base, 0, ct_bytes[:plaintext_len])
+
 
-    _write_file(args.out, bytes(plaintext[:plaintext_len]))
+def cmd_decfile(args):
+    algo = args.algo
+    if algo != 'hske-nla1':
+        sys.exit(f"decfile: unsupported algorithm {algo!r}")
+
+    key_int, nbits = _load_key(args.key)
+    if nbits != 256:
+        sys.exit(f"decfile: key must be 256-bit; got {nbits}-bit")
+
+    path = getattr(args, 'in')
+    fin  = sys.stdin.buffer if path == '-' else open(path, 'rb')
+    try:
+        magic = fin.read(4)
+        if magic == _HKX_MAGIC:
+            _write_file(args.out, _decfile_hkx1(key_int, magic + fin.read()))
+            return
+        if magic != _HKX2_MAGIC:
+            sys.exit(f"decfile: invalid magic {magic!r} "
+                     f"(expected {_HKX_MAGIC!r} or {_HKX2_MAGIC!r})")
+        hdr = fin.read(_HKX2_HDR_LEN - 4)
+        if len(hdr) < _HKX2_HDR_LEN - 4:
+            sys.exit("decfile: file too short to be a valid .hkx container")
+        if hdr[0] != _HKX_ALGO_NLA1:
+            sys.exit(f"decfile: unsupported algo byte 0x{hdr[0]:02x}")
+        seg = int.from_bytes(hdr[1:5], 'big')
+        if seg < _HKX_BLOCK or seg > _HKX2_SEG_MAX or seg % _HKX_BLOCK:
+            sys.exit("decfile: invalid HKX2 segment size")
+        nonce_bytes        = hdr[5:37]
+        base, seed, mac_iv = _hkx_schedule(key_int, int.from_bytes(nonce_bytes, 'big'))
+        prefix = _HKX2_SEG_DS + nonce_bytes + seg.to_bytes(4, 'big')
+
+        # Verify each segment before releasing its plaintext; drop the partial
+        # output file on any failure.
+        fout = sys.stdout.buffer if args.out == '-' else open(args.out, 'wb')
+        ok   = False
+        try:
+            rec = seg + 32
+            cur, idx = fin.read(rec), 0
+            while True:
+                if len(cur) < 32:
+                    sys.exit("decfile: file truncated (segment or auth tag missing)")
+                nxt   = fin.read(rec) if len(cur) == rec else b''
+                final = not nxt
+                ct    = cur[:-32]
+                if not _hmac.compare_digest(cur[-32:],
+                                            _hkx2_seg_tag(mac_iv, prefix, idx, final, ct)):
+                    sys.exit("decfile: authentication tag mismatch — file corrupt or wrong key")
+                blk0 = idx * (seg // _HKX_BLOCK)
+                if blk0 + (len(ct) + _HKX_BLOCK - 1) // _HKX_BLOCK > 1 << 32:
+                    sys.exit("decfile: container exceeds the 128 GiB HKX2 limit")
+                fout.write(_hkx_xor_ks(seed, base, blk0, ct))
+                if final:
+                    break
+                cur, idx = nxt, idx + 1
+            ok = True
+        finally:
+            if fout is not sys.stdout.buffer:
+                fout.close()
+                if not ok:
+                    os.remove(args.out)
+    finally:
+        if fin is not sys.stdin.buffer:
+            fin.close()
 
 
 # ---------------------------------------------------------------------------
@@ -2838,6 +2916,8 @@ def build_parser():
                     help='Plaintext file to encrypt')
     ef.add_argument('--out', required=True,
                     help='Output .hkx file')
+    ef.add_argument('--chunk', type=int, default=_HKX2_SEG_DEF,
+                    help='HKX2 segment size in bytes (multiple of 32; default 65536)')
 
     # decfile
     df = sub.add_parser('decfile',
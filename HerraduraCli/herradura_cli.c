@@ -16,6 +16,10 @@
 
 #include "../herradura.h"
 #include "herradura_codec.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 /* ─────────────────────────────────────────────────────────────────────────────
  * I/O helpers
@@ -31,10 +35,23 @@ static void die(const char *msg) { fputs(msg, stderr); fputc('\n', stderr); exit
 static void dief(const char *fmt, const char *s)
 { fprintf(stderr, fmt, s); fputc('\n', stderr); exit(1); }
 
-static uint8_t *read_binary_file(const char *path, size_t *len_out)
+/* Parse a plain decimal count into *v.  Returns 0 for anything else: a sign,
+ * leading blanks, trailing junk ("64k") or a value past 2^64 - 1. */
+static int parse_u64(const char *s, uint64_t *v)
+{
+    char *end;
+    unsigned long long x;
+    if (!s || *s < '0' || *s > '9') return 0;
+    errno = 0;
+    x = strtoull(s, &end, 10);
+    if (errno == ERANGE || *end != '\0') return 0;
+    *v = (uint64_t)x;
+    return 1;
+}
+
+/* Read the rest of an open stream into a malloc'd buffer. */
+static uint8_t *read_binary_stream(FILE *f, size_t *len_out)
 {
-    FILE *f = (strcmp(path, "-") == 0) ? stdin : fopen(path, "rb");
-    if (!f) { fprintf(stderr, "cannot open: %s\n", path); exit(1); }
     size_t cap = 4096, n = 0;
     uint8_t *buf = malloc(cap);
     if (!buf) die("out of memory");
@@ -44,11 +61,78 @@ static uint8_t *read_binary_file(const char *path, size_t *len_out)
         if (n == cap) { cap *= 2; uint8_t *nb = realloc(buf, cap);
             if (!nb) { free(buf); die("out of memory"); } buf = nb; }
     }
-    if (f != stdin) fclose(f);
     *len_out = n;
     return buf;
 }
 
+/* Inputs that are only hashed (dgst, sign/verify --digest) are mapped instead
+ * of copied, so they are read straight from the page cache.  The mapping is
+ * private and writable (copy-on-write): callers may still scribble on the
+ * buffer.  Pages not yet written still follow the file, so a concurrent
+ * writer shows through and a truncation faults: anything that authenticates
+ * and then reuses the bytes (decryption) must copy them out first.  Live
+ * mappings are remembered so release_binary_file() knows munmap from free. */
+#define CLI_MAX_MAPS 16
+static struct { uint8_t *p; size_t len; } g_cli_maps[CLI_MAX_MAPS];
+
+/* Map a regular file; NULL when it is not one (pipe, tty, empty, /proc). */
+static uint8_t *map_binary_file(const char *path, size_t *len_out)
+{
+    int fd, slot;
+    struct stat st;
+    void *p;
+    for (slot = 0; slot < CLI_MAX_MAPS && g_cli_maps[slot].p; slot++) ;
+    if (slot == CLI_MAX_MAPS || strcmp(path, "-") == 0) return NULL;
+    if ((fd = open(path, O_RDONLY)) < 0) return NULL;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0 ||
+        (uint64_t)st.st_size > (uint64_t)SIZE_MAX) { close(fd); return NULL; }
+    p = mmap(NULL, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) return NULL;
+#ifdef MADV_SEQUENTIAL
+    madvise(p, (size_t)st.st_size, MADV_SEQUENTIAL);
+#endif
+    g_cli_maps[slot].p = (uint8_t *)p;
+    g_cli_maps[slot].len = (size_t)st.st_size;
+    *len_out = (size_t)st.st_size;
+    return (uint8_t *)p;
+}
+
+static uint8_t *read_binary_file(const char *path, size_t *len_out)
+{
+    FILE *f = (strcmp(path, "-") == 0) ? stdin : fopen(path, "rb");
+    if (!f) { fprintf(stderr, "cannot open: %s\n", path); exit(1); }
+    uint8_t *buf = read_binary_stream(f, len_out);
+    if (f != stdin) fclose(f);
+    return buf;
+}
+
+/* Message for sign/verify: mapped when --digest hfscx-256 only hashes it,
+ * otherwise copied like any other input. */
+static uint8_t *read_msg_file(const char *path, const char *digest, size_t *len_out)
+{
+    uint8_t *buf;
+    if (digest && strcmp(digest, "hfscx-256") == 0 &&
+        (buf = map_binary_file(path, len_out)) != NULL)
+        return buf;
+    return read_binary_file(path, len_out);
+}
+
+/* Release a buffer from read_binary_file(), read_msg_file() or
+ * map_binary_file(). */
+static void release_binary_file(uint8_t *buf)
+{
+    int slot;
+    if (!buf) return;
+    for (slot = 0; slot < CLI_MAX_MAPS; slot++)
+        if (g_cli_maps[slot].p == buf) {
+            munmap(buf, g_cli_maps[slot].len);
+            g_cli_maps[slot].p = NULL;
+            return;
+        }
+    free(buf);
+}
+
 static void write_pem_file(const char *path, const char *label,
                            const uint8_t *der, size_t der_len)
 {
@@ -221,7 +305,7 @@ static void pem_key_load(PemKey *k, const char *path)
     if (!k->der) die("out of memory");
     if (pem_unwrap((char *)raw, raw_len, k->label, k->der, der_cap, &k->der_len) != 0)
         dief("cannot parse PEM from: %s", path);
-    free(raw);
+    release_binary_file(raw);
     if (der_parse_seq(k->der, k->der_len, k->vals, k->vlens, 16, &k->n_items) != 0)
         dief("cannot parse DER from: %s", path);
 }
@@ -237,7 +321,7 @@ static uint8_t *zkp_raw_pem_read(const char *path, const char *expect_label, siz
     uint8_t *buf = (uint8_t *)malloc(cap);
     if (!buf) die("out of memory");
     /* pem_read_file opens the file itself; raw is only for sizing */
-    free(raw);
+    release_binary_file(raw);
     size_t written;
     if (pem_read_file(path, label, buf, cap, &written) != 0)
         dief("cannot parse PEM from: %s", path);
@@ -525,8 +609,7 @@ static void cmd_genpkey(int argc, char **argv)
     const char *out  = get_arg(argc, argv, "--out");
     if (!algo) die("genpkey: --algo required");
 
-    FILE *urnd = fopen("/dev/urandom", "rb");
-    if (!urnd) die("cannot open /dev/urandom");
+    FILE *urnd = HERRADURA_OS_RNG;
 
     /* Classical GF key: (priv, pub=g^priv, n) */
     static const char *const classical[] = {
@@ -538,14 +621,14 @@ static void cmd_genpkey(int argc, char **argv)
         if (strcmp(algo, classical[ci]) != 0) continue;
         BitArray a, C;
         ba_rand(&a, urnd);
-        gf_pow_ba(&C, &GF_GEN, &a);
+        gf_pow_gen_ba(&C, &a);
         uint8_t ia[DER_INT_LEN(KEYBYTES)], iC[DER_INT_LEN(KEYBYTES)], in[8];
         size_t la, lC, ln;
         der_i32(a.b, ia, &la); der_i32(C.b, iC, &lC); der_i_n256(in, &ln);
         const uint8_t *it[3] = {ia, iC, in};
         size_t il[3] = {la, lC, ln};
         seq_and_write(it, il, 3, classical_labels[ci], out);
-        fclose(urnd); return;
+        return;
     }
 
     if (strcmp(algo, "hkex-rnl") == 0) {
@@ -557,7 +640,7 @@ static void cmd_genpkey(int argc, char **argv)
 
         /* Alice's contributory nonce n_A */
         uint8_t n_A[KEYBYTES];
-        if (fread(n_A, 1, KEYBYTES, urnd) != KEYBYTES) die("urandom read failed");
+        if (!urnd_read(urnd, n_A, KEYBYTES)) die("urandom read failed");
 
         uint8_t s_buf[RNL_N * 4], m_buf[RNL_N * 4];
         poly_pack(s_buf, s_poly, 4);
@@ -578,7 +661,7 @@ static void cmd_genpkey(int argc, char **argv)
         seq_and_write(it, il, 4, PEM_HKEX_RNL_PRIV, out);
         explicit_bzero(n_A, KEYBYTES);
         free(is_der); free(im_der); free(ina_der);
-        fclose(urnd); return;
+        return;
     }
 
     if (strcmp(algo, "hpks-stern") == 0 || strcmp(algo, "hpke-stern") == 0) {
@@ -596,7 +679,7 @@ static void cmd_genpkey(int argc, char **argv)
         const uint8_t *it[3] = {ie, is, in};
         size_t il[3] = {le, ls, ln};
         seq_and_write(it, il, 3, label, out);
-        fclose(urnd); return;
+        return;
     }
 
     /* ZKP-NL keypair: raw binary PEM (A, B, y, n) */
@@ -614,7 +697,7 @@ static void cmd_genpkey(int argc, char **argv)
         for (k=0;k<nb;k++) body[4+2*nb+k]  = (uint8_t)(y>>(8*(nb-1-k)));
         if (pem_write_file(out ? out : "-", PEM_ZKP_NL_PRIV, body, blen) != 0)
             die("cannot write ZKP-NL private key");
-        free(body); fclose(urnd); return;
+        free(body); return;
     }
 
     /* OPRF server key: SEQUENCE(INTEGER(k), INTEGER(256)) */
@@ -629,13 +712,13 @@ static void cmd_genpkey(int argc, char **argv)
         size_t il[2] = {lk, ln};
         seq_and_write(it, il, 2, PEM_OPRF_PRIV, out);
         explicit_bzero(&k, sizeof(k));
-        fclose(urnd); return;
+        return;
     }
 
     /* HPKS-WOTS-F one-time key: SEQUENCE(INTEGER(seed,32), INTEGER(leaf_idx=0)) */
     if (strcmp(algo, "hpks-wots") == 0) {
         uint8_t seed[KEYBYTES];
-        if (fread(seed, 1, KEYBYTES, urnd) != KEYBYTES) die("urandom read failed");
+        if (!urnd_read(urnd, seed, KEYBYTES)) die("urandom read failed");
         uint8_t is[DER_INT_LEN(KEYBYTES)], il0[DER_INT_LEN(8)];
         size_t ls, ll;
         der_i32(seed, is, &ls);
@@ -645,7 +728,7 @@ static void cmd_genpkey(int argc, char **argv)
         if (out && strcmp(out, "-") != 0) wots_write_idx(out, 0);
         fprintf(stderr, "HPKS-WOTS: ONE-TIME key — it may sign exactly one message.\n");
         explicit_bzero(seed, KEYBYTES);
-        fclose(urnd); return;
+        return;
     }
 
     /* HPKS-XMSS-F key: SEQUENCE(INTEGER(seed,32), INTEGER(h), INTEGER(next_idx=0),
@@ -655,7 +738,7 @@ static void cmd_genpkey(int argc, char **argv)
         int h_val = h_arg ? atoi(h_arg) : 10;
         if (h_val < 1 || h_val > 20) die("genpkey: --xmss-height must be in [1,20]");
         uint8_t seed[KEYBYTES];
-        if (fread(seed, 1, KEYBYTES, urnd) != KEYBYTES) die("urandom read failed");
+        if (!urnd_read(urnd, seed, KEYBYTES)) die("urandom read failed");
         fprintf(stderr, "Generating XMSS tree (h=%d, %d leaves) — may take a moment...\n",
                 h_val, 1 << h_val);
         uint8_t root[KEYBYTES];
@@ -677,7 +760,7 @@ static void cmd_genpkey(int argc, char **argv)
         if (out && strcmp(out, "-") != 0) xmss_write_idx(out, 0);
         free(ib); free(flat);
         explicit_bzero(seed, KEYBYTES);
-        fclose(urnd); return;
+        return;
     }
 
     /* HCRED user keypair (demo parameters, N=256) */
@@ -695,7 +778,7 @@ static void cmd_genpkey(int argc, char **argv)
         hcred_user_keygen(s_poly, C_poly, &e_ba, m_poly, urnd);
 
         uint8_t seed_H_raw[KEYBYTES];
-        if (fread(seed_H_raw, 1, KEYBYTES, urnd) != KEYBYTES) die("urandom read failed");
+        if (!urnd_read(urnd, seed_H_raw, KEYBYTES)) die("urandom read failed");
         BitArray seed_H_ba;
         memcpy(seed_H_ba.b, seed_H_raw, KEYBYTES);
         uint8_t syndr[SDF_SYNBYTES];
@@ -722,13 +805,13 @@ static void cmd_genpkey(int argc, char **argv)
         if (pem_write_file(out ? out : "-", PEM_HCRED_PRIV, body, blen) != 0)
             die("cannot write HCRED private key");
         free(body);
-        fclose(urnd); return;
+        return;
     }
 
     /* HPKE-Stern-KEM: QC-MDPC Niederreiter KEM with BGF decoder (TODO #126, Batch 2) */
     if (strcmp(algo, "hpke-stern-kem") == 0) {
         uint8_t seed_bytes[KEYBYTES];
-        if (fread(seed_bytes, 1, KEYBYTES, urnd) != KEYBYTES) die("urandom read failed");
+        if (!urnd_read(urnd, seed_bytes, KEYBYTES)) die("urandom read failed");
         QcMdpcPrf prf;
         qcprf_init(&prf, seed_bytes);
         QcMdpcPriv priv;
@@ -763,10 +846,9 @@ static void cmd_genpkey(int argc, char **argv)
         size_t il[6] = {lh0, lh1, ls0, ls1, lr, ld};
         seq_and_write(it, il, 6, PEM_HPKE_STERN_KEM_PRIV, out);
         explicit_bzero(&priv, sizeof(priv));
-        fclose(urnd); return;
+        return;
     }
 
-    fclose(urnd);
     dief("genpkey: unsupported algorithm: %s", algo);
 }
 
@@ -1291,8 +1373,7 @@ static void cmd_kex(int argc, char **argv)
     if (kdf && strcmp(kdf, "hfscx-256") != 0)
         dief("kex: unsupported --kdf value: %s", kdf);
 
-    FILE *urnd = fopen("/dev/urandom", "rb");
-    if (!urnd) die("cannot open /dev/urandom");
+    FILE *urnd = HERRADURA_OS_RNG;
 
     /* ── HKEX-GF ─── */
     if (strcmp(algo, "hkex-gf") == 0) {
@@ -1307,7 +1388,7 @@ static void cmd_kex(int argc, char **argv)
         if (!gf_pub_is_valid(&pub_theirs))
             die("kex: their public key is the GF(2^n)* identity/zero element "
                 "(rejected: degenerate key)");
-        gf_pow_ba(&sk, &pub_theirs, &priv);
+        gf_pow_win_ba(&sk, &pub_theirs, &priv);
         pem_key_free(&our); pem_key_free(&their);
 
         /* Apply KDF if requested: sk = HFSCX-256(sk) */
@@ -1326,7 +1407,7 @@ static void cmd_kex(int argc, char **argv)
         const uint8_t *it[2] = {isk, in}; size_t il[2] = {lsk, ln};
         seq_and_write(it, il, 2, PEM_SESSION_KEY, out_path);
         explicit_bzero(&sk, sizeof(sk));
-        fclose(urnd); return;
+        return;
     }
 
     /* ── HKEX-RNL ─── */
@@ -1367,7 +1448,7 @@ static void cmd_kex(int argc, char **argv)
 
             /* Bob's contributory nonce n_B */
             uint8_t n_B[KEYBYTES];
-            if (fread(n_B, 1, KEYBYTES, urnd) != KEYBYTES) die("urandom read failed");
+            if (!urnd_read(urnd, n_B, KEYBYTES)) die("urandom read failed");
 
             /* rnl_agree output is LSB-first; reverse to big-endian before KDF */
             uint8_t K_B_rev_raw[KEYBYTES]; int ri_kb;
@@ -1496,7 +1577,7 @@ static void cmd_kex(int argc, char **argv)
             dief("kex hkex-rnl: --their must be RNL PUBLIC KEY or RESPONSE PEM (got %s)",
                  their.label);
         }
-        fclose(urnd); return;
+        return;
     }
 
     /* ── hybrid-rnl-stern (TODO #167, port of TODO #162) ─── */
@@ -1538,7 +1619,7 @@ static void cmd_kex(int argc, char **argv)
             rnl_agree(&K1, s_B, C_A, NULL, hint);
 
             uint8_t n_B[KEYBYTES];
-            if (fread(n_B, 1, KEYBYTES, urnd) != KEYBYTES) die("urandom read failed");
+            if (!urnd_read(urnd, n_B, KEYBYTES)) die("urandom read failed");
 
             uint8_t K1_rev[KEYBYTES]; int ri;
             for (ri = 0; ri < KEYBYTES; ri++) K1_rev[ri] = K1.b[KEYBYTES-1-ri];
@@ -1557,7 +1638,7 @@ static void cmd_kex(int argc, char **argv)
 
             QcMdpcPrf prf;
             uint8_t seed_bytes[KEYBYTES];
-            if (fread(seed_bytes, 1, KEYBYTES, urnd) != KEYBYTES) die("urandom read failed");
+            if (!urnd_read(urnd, seed_bytes, KEYBYTES)) die("urandom read failed");
             qcprf_init(&prf, seed_bytes);
             QcPoly syn;
             BitArray K2;
@@ -1699,10 +1780,9 @@ static void cmd_kex(int argc, char **argv)
             dief("kex hybrid-rnl-stern: --their must be HKEX-RNL PUBLIC KEY or "
                  "HYBRID-RNL-STERN RESPONSE PEM (got %s)", their.label);
         }
-        fclose(urnd); return;
+        return;
     }
 
-    fclose(urnd);
     dief("kex: unsupported algorithm: %s", algo);
 }
 
@@ -1993,14 +2073,29 @@ static void cmd_dgst(int argc, char **argv)
     if (strcmp(algo, "hfscx-256") != 0 && strcmp(algo, "hfscx-256-ds") != 0)
         dief("dgst: unsupported algorithm: %s", algo);
 
-    size_t in_len;
-    uint8_t *in_buf = read_binary_file(in_path, &in_len);
-    uint8_t digest[32];
+    /* Hash a regular file straight from its mapping; stream anything else
+     * through the hash context in constant memory. */
+    uint8_t digest[32], *map;
+    size_t map_len;
+    HfscxCtx hc;
     if (strcmp(algo, "hfscx-256-ds") == 0)
-        hfscx_256_ds(0x01, in_buf, in_len, NULL, digest);
+        hfscx_256_ds_init(&hc, 0x01, NULL);
     else
-        hfscx_256(in_buf, in_len, NULL, digest);
-    free(in_buf);
+        hfscx_256_init(&hc, NULL);
+    if ((map = map_binary_file(in_path, &map_len)) != NULL) {
+        hfscx_256_update(&hc, map, map_len);
+        release_binary_file(map);
+    } else {
+        FILE *f = (strcmp(in_path, "-") == 0) ? stdin : fopen(in_path, "rb");
+        if (!f) dief("cannot open: %s", in_path);
+        uint8_t chunk[65536];
+        size_t r;
+        while ((r = fread(chunk, 1, sizeof chunk, f)) > 0)
+            hfscx_256_update(&hc, chunk, r);
+        if (ferror(f)) dief("dgst: read error: %s", in_path);
+        if (f != stdin) fclose(f);
+    }
+    hfscx_256_final(&hc, digest);
 
     if (!out_path || strcmp(out_path, "-") == 0) {
         /* Hex to stdout. */
@@ -2058,13 +2153,14 @@ static void cmd_rand(int argc, char **argv)
     const char *bytes_arg   = get_arg(argc, argv, "--bytes");
     const char *out_path    = get_arg(argc, argv, "--out");
     int hex = has_flag(argc, argv, "--hex");
+    int bulk = has_flag(argc, argv, "--bulk");
 
     HDrbg d;
     if (seed_path) {
         size_t slen, plen = pers ? strlen(pers) : 0;
         uint8_t *sbuf = read_binary_file(seed_path, &slen);
         drbg_seed(&d, sbuf, slen, (const uint8_t *)(pers ? pers : ""), plen);
-        free(sbuf);
+        release_binary_file(sbuf);
     } else if (state_path) {
         load_hdrbg_state(&d, state_path);
     } else {
@@ -2075,7 +2171,7 @@ static void cmd_rand(int argc, char **argv)
         size_t rlen;
         uint8_t *rbuf = read_binary_file(reseed_path, &rlen);
         drbg_reseed(&d, rbuf, rlen);
-        free(rbuf);
+        release_binary_file(rbuf);
     }
 
     if (bytes_arg) {
@@ -2083,7 +2179,7 @@ static void cmd_rand(int argc, char **argv)
         if (n < 0) die("rand: --bytes must be non-negative");
         uint8_t *out = (uint8_t *)malloc((size_t)n ? (size_t)n : 1);
         if (!out) die("rand: out of memory");
-        if (!drbg_generate(&d, out, (size_t)n))
+        if (!(bulk ? drbg_generate_bulk(&d, out, (size_t)n) : drbg_generate(&d, out, (size_t)n)))
             die("rand: output limit reached — reseed required");
         if (!out_path || strcmp(out_path, "-") == 0) {
             if (hex) { long i; for (i = 0; i < n; i++) printf("%02x", out[i]); putchar('\n'); }
@@ -2128,10 +2224,8 @@ static void cmd_enc(int argc, char **argv)
         BitArray K, N_nonce;
         load_sym_key(&K, key_path);
         const char *ad = get_arg(argc, argv, "--ad");
-        FILE *urnd = fopen("/dev/urandom", "rb");
-        if (!urnd) die("cannot open /dev/urandom");
+        FILE *urnd = HERRADURA_OS_RNG;
         ba_rand(&N_nonce, urnd);
-        fclose(urnd);
 
         uint8_t *ct_buf = malloc(in_len ? in_len : 1);
         if (!ct_buf) die("enc: out of memory");
@@ -2157,14 +2251,14 @@ static void cmd_enc(int argc, char **argv)
         const uint8_t *it[6] = {it0, itn, itl, itE, itt, itnb};
         size_t il[6] = {l0, ln, ll, lE, lt, lnb};
         seq_and_write(it, il, 6, PEM_CIPHERTEXT, out_path);
-        free(itE); free(ct_buf); free(in_buf);
+        free(itE); free(ct_buf); release_binary_file(in_buf);
         return;
     }
 
     /* Plaintext BitArray: input left-aligned into big-endian block, zero-padded. */
     BitArray P;
     make_msg_ba(&P, in_buf, in_len);
-    free(in_buf);
+    release_binary_file(in_buf);
 
     /* ── Symmetric algos ── */
     if (strcmp(algo, "hske") == 0 || strcmp(algo, "hske-nla1") == 0 ||
@@ -2185,11 +2279,9 @@ static void cmd_enc(int argc, char **argv)
         } else if (strcmp(algo, "hske-nla1") == 0) {
             int aead = has_flag(argc, argv, "--aead");
             const char *ad = get_arg(argc, argv, "--ad");
-            FILE *urnd = fopen("/dev/urandom", "rb");
-            if (!urnd) die("cannot open /dev/urandom");
+            FILE *urnd = HERRADURA_OS_RNG;
             BitArray N_nonce;
             ba_rand(&N_nonce, urnd);
-            fclose(urnd);
             if (ad && !aead) die("enc: --ad requires --aead");
 
             if (aead) {
@@ -2230,8 +2322,11 @@ static void cmd_enc(int argc, char **argv)
 
         } else { /* hske-nla2 */
             BitArray E;
-            if (!nl_v2_key_is_valid(&K)) die("enc hske-nla2: " WEAK_V2_KEY_MSG);
-            nl_fscx_revolve_v2_ba(&E, &P, &K, R_VALUE);
+            NlV2Ctx kc;
+            nl_v2_ctx_init(&kc, &K);
+            if (!nl_v2_ctx_is_valid(&kc)) die("enc hske-nla2: " WEAK_V2_KEY_MSG);
+            nl_v2_ctx_revolve(&E, &P, &kc, R_VALUE);
+            explicit_bzero(&kc, sizeof(kc));
             uint8_t it0[8], itE[DER_INT_LEN(KEYBYTES)], itn[8];
             size_t l0, lE, ln;
             der_i_byte(0, it0, &l0); der_i32(E.b, itE, &lE); der_i_n256(itn, &ln);
@@ -2250,32 +2345,35 @@ static void cmd_enc(int argc, char **argv)
         /* vals[0]=pub (32 bytes), vals[1]=n */
         if (pub_k.n_items < 1) die("enc: malformed public key");
         BitArray pub, r, R, enc_key, E;
+        NlV2Ctx kc;
         ba_from_ra(&pub, pub_k.vals[0], pub_k.vlens[0]);
         pem_key_free(&pub_k);
         if (!gf_pub_is_valid(&pub))
             die("enc: public key is the GF(2^n)* identity/zero element "
                 "(rejected: degenerate key)");
 
-        FILE *urnd = fopen("/dev/urandom", "rb");
-        if (!urnd) die("cannot open /dev/urandom");
+        FILE *urnd = HERRADURA_OS_RNG;
         /* r is ours to choose, so for hpke-nl resample past the ~2^-129 affine
          * weak-key class (TODO #168) rather than failing an honest encryption. */
         {
             int attempt;
             for (attempt = 0; attempt < 64; attempt++) {
                 ba_rand(&r, urnd);
-                gf_pow_ba(&R, &GF_GEN, &r);
-                gf_pow_ba(&enc_key, &pub, &r);
-                if (strcmp(algo, "hpke") == 0 || nl_v2_key_is_valid(&enc_key)) break;
+                gf_pow_gen_ba(&R, &r);
+                gf_pow_win_ba(&enc_key, &pub, &r);
+                if (strcmp(algo, "hpke") == 0) break;
+                nl_v2_ctx_init(&kc, &enc_key);
+                if (nl_v2_ctx_is_valid(&kc)) break;
             }
             if (attempt == 64)
                 die("enc hpke-nl: could not sample a non-degenerate ephemeral key");
         }
-        fclose(urnd);
         if (strcmp(algo, "hpke") == 0)
             ba_fscx_revolve(&E, &P, &enc_key, I_VALUE);
-        else
-            nl_fscx_revolve_v2_ba(&E, &P, &enc_key, I_VALUE);
+        else {
+            nl_v2_ctx_revolve(&E, &P, &kc, I_VALUE);
+            explicit_bzero(&kc, sizeof(kc));
+        }
         uint8_t iR[DER_INT_LEN(KEYBYTES)], iE[DER_INT_LEN(KEYBYTES)], in[8];
         size_t lR, lE, ln;
         der_i32(R.b, iR, &lR); der_i32(E.b, iE, &lE); der_i_n256(in, &ln);
@@ -2296,11 +2394,9 @@ static void cmd_enc(int argc, char **argv)
         }
         pem_key_free(&pub_k);
 
-        FILE *urnd = fopen("/dev/urandom", "rb");
-        if (!urnd) die("cannot open /dev/urandom");
+        FILE *urnd = HERRADURA_OS_RNG;
         uint8_t seed_bytes[KEYBYTES];
-        if (fread(seed_bytes, 1, KEYBYTES, urnd) != KEYBYTES) die("urandom read failed");
-        fclose(urnd);
+        if (!urnd_read(urnd, seed_bytes, KEYBYTES)) die("urandom read failed");
         QcMdpcPrf prf;
         qcprf_init(&prf, seed_bytes);
         QcPoly syn;
@@ -2335,11 +2431,9 @@ static void cmd_enc(int argc, char **argv)
         ba_from_ra(&seed_ba, pub_k.vals[1], pub_k.vlens[1]);
         pem_key_free(&pub_k);
 
-        FILE *urnd = fopen("/dev/urandom", "rb");
-        if (!urnd) die("cannot open /dev/urandom");
+        FILE *urnd = HERRADURA_OS_RNG;
         uint8_t ct_syndr[SDF_SYNBYTES];
         hpke_stern_f_encap(&K_ba, ct_syndr, &e_p, &seed_ba, urnd);
-        fclose(urnd);
         ba_fscx_revolve(&E, &P, &K_ba, I_VALUE);
 
         /* Syndrome: zero-pad SDF_SYNBYTES → KEYBYTES. */
@@ -2464,8 +2558,11 @@ static void cmd_dec(int argc, char **argv)
             if (strcmp(algo, "hske") == 0)
                 ba_fscx_revolve(&D, &E, &K, R_VALUE);
             else {
-                if (!nl_v2_key_is_valid(&K)) die("dec hske-nla2: " WEAK_V2_KEY_MSG);
-                nl_fscx_revolve_v2_inv_ba(&D, &E, &K, R_VALUE);
+                NlV2Ctx kc;
+                nl_v2_ctx_init(&kc, &K);
+                if (!nl_v2_ctx_is_valid(&kc)) die("dec hske-nla2: " WEAK_V2_KEY_MSG);
+                nl_v2_ctx_revolve_inv(&D, &E, &kc, R_VALUE);
+                explicit_bzero(&kc, sizeof(kc));
             }
         }
         write_binary_file(out_path, D.b, KEYBYTES);
@@ -2486,12 +2583,15 @@ static void cmd_dec(int argc, char **argv)
         ba_from_ra(&R,    ct.vals[0],     ct.vlens[0]);
         ba_from_ra(&E,    ct.vals[1],     ct.vlens[1]);
         pem_key_free(&ct); pem_key_free(&priv_k);
-        gf_pow_ba(&dec_key, &R, &priv);
+        gf_pow_win_ba(&dec_key, &R, &priv);
         if (strcmp(algo, "hpke") == 0)
             ba_fscx_revolve(&D, &E, &dec_key, R_VALUE);
         else {
-            if (!nl_v2_key_is_valid(&dec_key)) die("dec hpke-nl: " WEAK_V2_KEY_MSG);
-            nl_fscx_revolve_v2_inv_ba(&D, &E, &dec_key, I_VALUE);
+            NlV2Ctx kc;
+            nl_v2_ctx_init(&kc, &dec_key);
+            if (!nl_v2_ctx_is_valid(&kc)) die("dec hpke-nl: " WEAK_V2_KEY_MSG);
+            nl_v2_ctx_revolve_inv(&D, &E, &kc, I_VALUE);
+            explicit_bzero(&kc, sizeof(kc));
         }
         write_binary_file(out_path, D.b, KEYBYTES);
 
@@ -2604,12 +2704,10 @@ static void cmd_threshold_commit(int argc, char **argv)
     BitArray priv, pub;
     load_hpks_priv_for_threshold(key_path, &priv, &pub);  /* nbits always 256 */
 
-    FILE *urnd = fopen("/dev/urandom", "rb");
-    if (!urnd) die("cannot open /dev/urandom");
+    FILE *urnd = HERRADURA_OS_RNG;
     BitArray k_j, R_j;
     ba_rand(&k_j, urnd);
-    fclose(urnd);
-    gf_pow_ba(&R_j, &GF_GEN_BA, &k_j);
+    gf_pow_gen_ba(&R_j, &k_j);
 
     /* commitment: DER seq(R_j, C_j, n=256) */
     uint8_t iR[DER_INT_LEN(KEYBYTES)], iC[DER_INT_LEN(KEYBYTES)], in[8];
@@ -2642,7 +2740,7 @@ static void cmd_threshold_aggregate(int argc, char **argv)
 
     /* Load message */
     size_t in_len;
-    uint8_t *in_buf = read_binary_file(in_path, &in_len);
+    uint8_t *in_buf = read_msg_file(in_path, digest, &in_len);
     uint8_t msg_bytes[KEYBYTES];
     if (digest && strcmp(digest, "hfscx-256") == 0) {
         hfscx_256(in_buf, in_len, NULL, msg_bytes);
@@ -2651,7 +2749,7 @@ static void cmd_threshold_aggregate(int argc, char **argv)
         size_t cp = in_len < KEYBYTES ? in_len : KEYBYTES;
         memcpy(msg_bytes, in_buf, cp);
     }
-    free(in_buf);
+    release_binary_file(in_buf);
     BitArray msg; memcpy(msg.b, msg_bytes, KEYBYTES);
 
     /* Load all commitment PEMs */
@@ -2828,7 +2926,7 @@ static void cmd_threshold_verify(int argc, char **argv)
     if (!sig_path) die("threshold-verify: --sig required");
 
     size_t in_len;
-    uint8_t *in_buf = read_binary_file(in_path, &in_len);
+    uint8_t *in_buf = read_msg_file(in_path, digest, &in_len);
     uint8_t msg_bytes[KEYBYTES];
     if (digest && strcmp(digest, "hfscx-256") == 0) {
         hfscx_256(in_buf, in_len, NULL, msg_bytes);
@@ -2837,7 +2935,7 @@ static void cmd_threshold_verify(int argc, char **argv)
         size_t cp = in_len < KEYBYTES ? in_len : KEYBYTES;
         memcpy(msg_bytes, in_buf, cp);
     }
-    free(in_buf);
+    release_binary_file(in_buf);
     BitArray msg; memcpy(msg.b, msg_bytes, KEYBYTES);
 
     PemKey sk; pem_key_load(&sk, sig_path);
@@ -2870,7 +2968,7 @@ static void cmd_sign(int argc, char **argv)
     if (!in_path)  die("sign: --in required");
 
     size_t in_len;
-    uint8_t *in_buf = read_binary_file(in_path, &in_len);
+    uint8_t *in_buf = read_msg_file(in_path, digest, &in_len);
     uint8_t msg_bytes[KEYBYTES];
 
     /* HPKS-WOTS-F signs the full message (hashed internally), not a truncated
@@ -2898,7 +2996,7 @@ static void cmd_sign(int argc, char **argv)
         }
         BitArray sig[WOTS_L];
         hpks_wots_sign(sig, wmsg, wmlen, seed_ba.b, leaf_idx);
-        free(in_buf);
+        release_binary_file(in_buf);
 
         uint8_t blob[WOTS_L * KEYBYTES];
         wots_blob_pack(blob, sig);
@@ -2950,7 +3048,7 @@ static void cmd_sign(int argc, char **argv)
         }
         HpksXmssSig sig;
         hpks_xmss_sign(&sig, wmsg, wmlen, seed, flat, num_leaves, leaf_idx);
-        free(in_buf);
+        release_binary_file(in_buf);
         free(flat);
 
         uint8_t sig_blob[WOTS_L * KEYBYTES];
@@ -2987,15 +3085,14 @@ static void cmd_sign(int argc, char **argv)
         memcpy(msg_bytes, in_buf, cp);
         in_len = KEYBYTES;
     }
-    free(in_buf);
+    release_binary_file(in_buf);
 
     BitArray msg;
     memcpy(msg.b, msg_bytes, KEYBYTES);
 
     /* nl-zkboo uses raw binary PEM — handle before pem_key_load. */
     if (strcmp(algo, "nl-zkboo") == 0) {
-        FILE *urnd2 = fopen("/dev/urandom", "rb");
-        if (!urnd2) die("cannot open /dev/urandom");
+        FILE *urnd2 = HERRADURA_OS_RNG;
         size_t kblen;
         uint8_t *kbody = zkp_raw_pem_read(key_path, PEM_ZKP_NL_PRIV, &kblen);
         if (kblen < 4) die("sign: malformed ZKP-NL private key");
@@ -3010,7 +3107,6 @@ static void cmd_sign(int argc, char **argv)
         free(kbody);
         ZkpNlRound *zk_proof = zkp_nl_prove(zkA, zkB, zky, nl_n, ZKP_NL_PROD_ROUNDS,
                                              msg_bytes, KEYBYTES, urnd2);
-        fclose(urnd2);
         size_t pack_len;
         uint8_t *pack = zkp_nl_pack_proof(zk_proof, ZKP_NL_PROD_ROUNDS, nl_n, &pack_len);
         zkp_nl_proof_free(zk_proof, ZKP_NL_PROD_ROUNDS);
@@ -3022,8 +3118,7 @@ static void cmd_sign(int argc, char **argv)
 
     /* nl-zkbpp: ZKB++ compact encoding of the same ZKP-NL statement */
     if (strcmp(algo, "nl-zkbpp") == 0) {
-        FILE *urnd2 = fopen("/dev/urandom", "rb");
-        if (!urnd2) die("cannot open /dev/urandom");
+        FILE *urnd2 = HERRADURA_OS_RNG;
         size_t kblen;
         uint8_t *kbody = zkp_raw_pem_read(key_path, PEM_ZKP_NL_PRIV, &kblen);
         if (kblen < 4) die("sign: malformed ZKP-NL private key");
@@ -3038,7 +3133,6 @@ static void cmd_sign(int argc, char **argv)
         free(kbody);
         ZkpNlPpRound *pp_proof = zkp_nl_pp_prove(zkA, zkB, zky, nl_n, ZKP_NL_PROD_ROUNDS,
                                                   msg_bytes, KEYBYTES, urnd2);
-        fclose(urnd2);
         size_t pack_len;
         uint8_t *pack = zkp_nl_pp_pack_proof(pp_proof, ZKP_NL_PROD_ROUNDS, nl_n, &pack_len);
         zkp_nl_pp_proof_free(pp_proof, ZKP_NL_PROD_ROUNDS);
@@ -3051,8 +3145,7 @@ static void cmd_sign(int argc, char **argv)
     PemKey priv_k;
     pem_key_load(&priv_k, key_path);
 
-    FILE *urnd = fopen("/dev/urandom", "rb");
-    if (!urnd) die("cannot open /dev/urandom");
+    FILE *urnd = HERRADURA_OS_RNG;
 
     if (strcmp(algo, "hpks") == 0 || strcmp(algo, "hpks-nl") == 0) {
         if (priv_k.n_items < 1) die("sign: malformed private key");
@@ -3061,7 +3154,7 @@ static void cmd_sign(int argc, char **argv)
         pem_key_free(&priv_k);
 
         ba_rand(&k_rand, urnd);
-        gf_pow_ba(&R, &GF_GEN, &k_rand);
+        gf_pow_gen_ba(&R, &k_rand);
         if (strcmp(algo, "hpks") == 0)
             ba_fscx_revolve(&e, &R, &msg, I_VALUE);
         else
@@ -3163,17 +3256,81 @@ static void cmd_sign(int argc, char **argv)
 
     } else {
         pem_key_free(&priv_k);
-        fclose(urnd);
         dief("sign: unsupported algorithm: %s", algo);
     }
 
-    fclose(urnd);
 }
 
 /* ─────────────────────────────────────────────────────────────────────────────
  * verify
  * ───────────────────────────────────────────────────────────────────────────── */
 
+/* verify --algo hpks --batch LIST: each non-blank, non-'#' line of LIST is
+ * "PUBKEY.pem MSGFILE SIG.pem".  All signatures are checked together by
+ * hpks_verify_batch; on failure the first bad entry (1-based) is reported. */
+static void cmd_verify_batch(const char *list_path, const char *digest)
+{
+    FILE *lf = strcmp(list_path, "-") == 0 ? stdin : fopen(list_path, "r");
+    if (!lf) dief("verify: cannot open batch list: %s", list_path);
+
+    size_t n = 0, cap = 0;
+    BitArray *msgs = NULL, *pubs = NULL, *Rs = NULL, *ss = NULL;
+    char line[4096];
+    while (fgets(line, sizeof(line), lf)) {
+        char pk_path[1024], in_path[1024], sig_path[1024], extra;
+        char *p = line;
+        while (*p == ' ' || *p == '\t') p++;
+        if (*p == '\0' || *p == '\n' || *p == '\r' || *p == '#') continue;
+        if (sscanf(p, "%1023s %1023s %1023s %c", pk_path, in_path, sig_path, &extra) != 3)
+            dief("verify: malformed batch line: %s", line);
+
+        if (n == cap) {
+            cap = cap ? 2 * cap : 16;
+            msgs = (BitArray *)realloc(msgs, cap * sizeof(BitArray));
+            pubs = (BitArray *)realloc(pubs, cap * sizeof(BitArray));
+            Rs   = (BitArray *)realloc(Rs,   cap * sizeof(BitArray));
+            ss   = (BitArray *)realloc(ss,   cap * sizeof(BitArray));
+            if (!msgs || !pubs || !Rs || !ss) die("out of memory");
+        }
+
+        size_t in_len;
+        uint8_t *in_buf = read_msg_file(in_path, digest, &in_len);
+        if (digest && strcmp(digest, "hfscx-256") == 0) {
+            hfscx_256(in_buf, in_len, NULL, msgs[n].b);
+        } else {
+            size_t cp = in_len < KEYBYTES ? in_len : KEYBYTES;
+            memset(msgs[n].b, 0, KEYBYTES);
+            memcpy(msgs[n].b, in_buf, cp);
+        }
+        release_binary_file(in_buf);
+
+        PemKey pub_k;
+        pem_key_load(&pub_k, pk_path);
+        if (pub_k.n_items < 1) dief("verify: malformed public key: %s", pk_path);
+        ba_from_ra(&pubs[n], pub_k.vals[0], pub_k.vlens[0]);
+        pem_key_free(&pub_k);
+
+        PemKey sig_k;
+        pem_key_load(&sig_k, sig_path);
+        if (strcmp(sig_k.label, PEM_SIGNATURE) != 0 || sig_k.n_items < 3)
+            dief("verify: invalid signature PEM: %s", sig_path);
+        ba_from_ra(&ss[n], sig_k.vals[0], sig_k.vlens[0]);
+        ba_from_ra(&Rs[n], sig_k.vals[1], sig_k.vlens[1]);
+        pem_key_free(&sig_k);
+        n++;
+    }
+    if (lf != stdin) fclose(lf);
+    if (n == 0) die("verify: batch list is empty");
+
+    FILE *urnd = HERRADURA_OS_RNG;
+    size_t bad = 0;
+    int ok = hpks_verify_batch(msgs, pubs, Rs, ss, n, urnd, &bad);
+    free(msgs); free(pubs); free(Rs); free(ss);
+    if (ok < 0) die("verify: out of memory");
+    if (ok) { printf("Batch OK: %zu signatures\n", n);           exit(0); }
+    else    { printf("Verification FAILED: entry %zu\n", bad + 1); exit(1); }
+}
+
 static void cmd_verify(int argc, char **argv)
 {
     const char *algo        = get_arg(argc, argv, "--algo");
@@ -3181,14 +3338,20 @@ static void cmd_verify(int argc, char **argv)
     const char *in_path     = get_arg(argc, argv, "--in");
     const char *sig_path    = get_arg(argc, argv, "--sig");
     const char *digest      = get_arg(argc, argv, "--digest");
+    const char *batch_path  = get_arg(argc, argv, "--batch");
     if (!algo)    die("verify: --algo required");
+    if (batch_path) {
+        if (strcmp(algo, "hpks") != 0) die("verify: --batch supports --algo hpks only");
+        cmd_verify_batch(batch_path, digest);
+        return;
+    }
     if (!in_path) die("verify: --in required");
     if (!sig_path) die("verify: --sig required");
     if (!pubkey_path && strcmp(algo, "hpks-t") != 0 && strcmp(algo, "hpks-ring") != 0)
         die("verify: --pubkey required");
 
     size_t in_len;
-    uint8_t *in_buf = read_binary_file(in_path, &in_len);
+    uint8_t *in_buf = read_msg_file(in_path, digest, &in_len);
     uint8_t msg_bytes[KEYBYTES];
 
     /* HPKS-WOTS-F verifies against the full message (hashed internally). */
@@ -3215,7 +3378,7 @@ static void cmd_verify(int argc, char **argv)
         pem_key_free(&sigk);
 
         int ok = hpks_wots_verify(wmsg, wmlen, sig, pk);
-        free(in_buf);
+        release_binary_file(in_buf);
         if (ok) { puts("Signature OK");        exit(0); }
         else    { puts("Verification FAILED"); exit(1); }
     }
@@ -3256,7 +3419,7 @@ static void cmd_verify(int argc, char **argv)
 
         int ok = hpks_xmss_verify(wmsg, wmlen, &sig, root);
         hpks_xmss_sig_free(&sig);
-        free(in_buf);
+        release_binary_file(in_buf);
         if (ok) { puts("Signature OK");        exit(0); }
         else    { puts("Verification FAILED"); exit(1); }
     }
@@ -3268,7 +3431,7 @@ static void cmd_verify(int argc, char **argv)
         size_t cp = in_len < KEYBYTES ? in_len : KEYBYTES;
         memcpy(msg_bytes, in_buf, cp);
     }
-    free(in_buf);
+    release_binary_file(in_buf);
 
     BitArray msg;
     memcpy(msg.b, msg_bytes, KEYBYTES);
@@ -3381,10 +3544,8 @@ static void cmd_verify(int argc, char **argv)
             nl_fscx_revolve_v1_ba(&e_v, &R, &msg, I_VALUE);
 
         /* lhs = g^s * pub^e_v; OK if lhs == R */
-        BitArray lhs1, lhs2, lhs;
-        gf_pow_ba(&lhs1, &GF_GEN, &s_ba);
-        gf_pow_ba(&lhs2, &pub,    &e_v);
-        gf_mul_ba(&lhs, &lhs1, &lhs2);
+        BitArray lhs;
+        gf_pow2_vartime_ba(&lhs, &GF_GEN, &s_ba, &pub, &e_v);
 
         if (ba_equal(&lhs, &R)) { puts("Signature OK");          exit(0); }
         else                    { puts("Verification FAILED");   exit(1); }
@@ -3463,118 +3624,153 @@ static void cmd_verify(int argc, char **argv)
 
 /* ─────────────────────────────────────────────────────────────────────────────
  * encfile / decfile  (HSKE-NL-A1 CTR-mode AEAD for arbitrary-size files)
- * .hkx format:  magic(4) | algo(1) | len_be8(8) | nonce(32) | ct(n*32) | tag(32)
+ * encfile writes the segmented HKX2 container (see herradura.h) through a
+ * two-segment window, so memory use is bounded by --chunk, not the file size.
+ * decfile streams HKX2 and still accepts the whole-file HKX1 format:
+ *   magic(4) | algo(1) | len_be8(8) | nonce(32) | ct(n*32) | tag(32)
  * ───────────────────────────────────────────────────────────────────────────── */
 
+/* --threads N for the file commands: 1 by default, 0 = every online CPU. */
+static int get_threads(int argc, char **argv)
+{
+    const char *s = get_arg(argc, argv, "--threads");
+    uint64_t n = 1;
+    if (s && (!parse_u64(s, &n) || n > 1024))
+        die("--threads must be between 0 and 1024");
+    if (n == 0) {
+#ifdef _SC_NPROCESSORS_ONLN
+        long c = sysconf(_SC_NPROCESSORS_ONLN);
+        if (c < 1) die("--threads 0: cannot count the online CPUs");
+        n = c > 1024 ? 1024 : (uint64_t)c;
+#else
+        die("--threads 0: cannot count the online CPUs on this platform");
+#endif
+    }
+    return (int)n;
+}
+
+/* Segments per window: one per thread, but never more than HKX_WIN_BYTES of
+ * buffer (1024 threads of 16 MiB segments would ask for 16 GiB, and wrap
+ * size_t on 32-bit hosts).  win * rec then always fits. */
+#define HKX_WIN_BYTES ((size_t)256 << 20)
+static size_t hkx_window(int nthreads, size_t rec)
+{
+    size_t win = (size_t)nthreads;
+    if (win > HKX_WIN_BYTES / rec) win = HKX_WIN_BYTES / rec;
+    return win ? win : 1;
+}
+
+/* Fill buf from in; *eof is set once the stream has nothing after this
+ * window, so the caller can tell whether its last segment is final. */
+static size_t hkx_read_window(FILE *in, uint8_t *buf, size_t cap, int *eof)
+{
+    size_t n = fread(buf, 1, cap, in);
+    int c;
+    if (n < cap) { *eof = 1; return n; }
+    c = getc(in);
+    if (c == EOF) *eof = 1;
+    else ungetc(c, in);
+    return n;
+}
+
+/* Remove a partially written output file, then exit with msg. */
+static void hkx_abort(FILE *out, const char *out_path, const char *msg)
+{
+    if (out && out != stdout) { fclose(out); remove(out_path); }
+    die(msg);
+}
+
 static void cmd_encfile(int argc, char **argv)
 {
-    const char *algo     = get_arg(argc, argv, "--algo");
-    const char *key_path = get_arg(argc, argv, "--key");
-    const char *in_path  = get_arg(argc, argv, "--in");
-    const char *out_path = get_arg(argc, argv, "--out");
+    const char *algo      = get_arg(argc, argv, "--algo");
+    const char *key_path  = get_arg(argc, argv, "--key");
+    const char *in_path   = get_arg(argc, argv, "--in");
+    const char *out_path  = get_arg(argc, argv, "--out");
+    const char *chunk_str = get_arg(argc, argv, "--chunk");
     if (!algo)     algo = "hske-nla1";
     if (!key_path) die("encfile: --key required");
     if (!in_path)  die("encfile: --in required");
     if (!out_path) die("encfile: --out required");
     if (strcmp(algo, "hske-nla1") != 0)
         dief("encfile: unsupported algorithm %s", algo);
+    uint64_t seg64 = HKX2_SEG_DEFAULT;
+    if (chunk_str && !parse_u64(chunk_str, &seg64)) seg64 = 0;
+    if (seg64 > HKX2_SEG_MAX || !hkx2_seg_size_ok((uint32_t)seg64))
+        die("encfile: --chunk must be a multiple of 32 between 32 and 16777216");
+    uint32_t seg = (uint32_t)seg64;
+    int nthreads = get_threads(argc, argv);
 
     BitArray K;
     load_sym_key(&K, key_path);
 
-    size_t plaintext_len;
-    uint8_t *plaintext = read_binary_file(in_path, &plaintext_len);
+    FILE *in = (strcmp(in_path, "-") == 0) ? stdin : fopen(in_path, "rb");
+    if (!in) dief("encfile: cannot open %s", in_path);
 
     /* Generate nonce */
-    FILE *urnd = fopen("/dev/urandom", "rb");
-    if (!urnd) die("cannot open /dev/urandom");
+    FILE *urnd = HERRADURA_OS_RNG;
     uint8_t nonce_bytes[32];
-    if (fread(nonce_bytes, 1, 32, urnd) != 32) die("urandom read failed");
-    fclose(urnd);
+    if (!urnd_read(urnd, nonce_bytes, 32)) die("urandom read failed");
 
-    /* Derive base and seed */
-    BitArray N_nonce, base, seed;
+    /* Derive base, seed and the per-file tag midstate */
+    BitArray N_nonce, base, seed, mac_key_ba;
+    HfscxCtx pre;
     ba_from_ra(&N_nonce, nonce_bytes, 32);
     ba_xor(&base, &K, &N_nonce);
     ba_rnl_kdf_seed(&seed, &base);
-
-    /* Encrypt: ks_i = hske_nla1_ks_block(seed, base, i); ct_i = pt_i XOR ks_i */
-    size_t n_blocks = (plaintext_len + KEYBYTES - 1) / KEYBYTES;
-    uint8_t *ct_buf = n_blocks > 0 ? (uint8_t *)malloc(n_blocks * KEYBYTES) : NULL;
-    if (n_blocks > 0 && !ct_buf) die("out of memory");
-    {
-        size_t bi;
-        for (bi = 0; bi < n_blocks; bi++) {
-            uint8_t p_blk[32];
-            size_t chunk = plaintext_len - bi * KEYBYTES;
-            if (chunk > KEYBYTES) chunk = KEYBYTES;
-            memcpy(p_blk, plaintext + bi * KEYBYTES, chunk);
-            if (chunk < KEYBYTES) memset(p_blk + chunk, 0, KEYBYTES - chunk);
-            BitArray ks;
-            hske_nla1_ks_block(&seed, &base, (uint32_t)bi, &ks);
-            int j;
-            for (j = 0; j < KEYBYTES; j++)
-                ct_buf[bi * KEYBYTES + j] = p_blk[j] ^ ks.b[j];
-        }
-    }
-    free(plaintext);
-
-    /* MAC key: nl_fscx_revolve_v1(ROL(seed, n/4), base, I_VALUE) */
-    BitArray mac_key_ba;
     hske_nla1_mac_key(&seed, &base, &mac_key_ba);
-    uint8_t mac_iv[32];
-    { int j; for (j = 0; j < 32; j++) mac_iv[j] = mac_key_ba.b[j] ^ _HFSCX256_IV[j]; }
+    hkx2_tag_init(&pre, &mac_key_ba, &N_nonce, seg);
 
-    /* Auth tag: HFSCX-256-MAC(mac_iv, nonce || len_be8 || ciphertext) */
-    size_t mac_len = 32 + 8 + n_blocks * KEYBYTES;
-    uint8_t *mac_data = (uint8_t *)malloc(mac_len);
-    if (!mac_data) die("out of memory");
-    memcpy(mac_data, nonce_bytes, 32);
-    { int j; uint64_t pl = (uint64_t)plaintext_len;
-      for (j = 0; j < 8; j++) mac_data[32+j] = (uint8_t)((pl >> (56 - 8*j)) & 0xFF); }
-    if (n_blocks > 0) memcpy(mac_data + 40, ct_buf, n_blocks * KEYBYTES);
-    uint8_t tag[32];
-    hfscx_256(mac_data, mac_len, mac_iv, tag);
-    free(mac_data);
-
-    /* Write .hkx file */
     FILE *out = fopen(out_path, "wb");
     if (!out) dief("encfile: cannot open %s for writing", out_path);
-    uint8_t hdr[45];
-    hdr[0]='H'; hdr[1]='K'; hdr[2]='X'; hdr[3]='1'; hdr[4]=0x01;
-    { int j; uint64_t pl = (uint64_t)plaintext_len;
-      for (j = 0; j < 8; j++) hdr[5+j] = (uint8_t)((pl >> (56 - 8*j)) & 0xFF); }
-    memcpy(hdr+13, nonce_bytes, 32);
-    fwrite(hdr, 1, 45, out);
-    if (n_blocks > 0) fwrite(ct_buf, 1, n_blocks * KEYBYTES, out);
-    fwrite(tag, 1, 32, out);
-    fclose(out);
-    free(ct_buf);
+    uint8_t hdr[HKX2_HDR_LEN];
+    hdr[0]='H'; hdr[1]='K'; hdr[2]='X'; hdr[3]='2'; hdr[4]=0x01;
+    { int j; for (j = 0; j < 4; j++) hdr[5+j] = (uint8_t)(seg >> (24 - 8*j)); }
+    memcpy(hdr+9, nonce_bytes, 32);
+    fwrite(hdr, 1, HKX2_HDR_LEN, out);
+
+    /* One segment per thread per window; segments are sealed in parallel. */
+    size_t win = hkx_window(nthreads, seg);
+    uint8_t *buf = (uint8_t *)malloc(win * seg), *tags = (uint8_t *)malloc(win * 32);
+    if (!buf || !tags) die("out of memory");
+    ParPool pool;
+    par_pool_init(&pool, (int)win);
+    Hkx2Batch bt;
+    memset(&bt, 0, sizeof bt);
+    bt.seed = &seed; bt.base = &base; bt.pre = &pre; bt.seg = seg;
+    bt.buf = buf; bt.stride = seg; bt.tags = tags;
+    uint64_t idx = 0;
+    int eof = 0;
+    while (!eof) {
+        size_t n = hkx_read_window(in, buf, win * seg, &eof), i;
+        if (ferror(in)) hkx_abort(out, out_path, "encfile: read error");
+        bt.idx0 = idx;
+        bt.cnt = n ? (n + seg - 1) / seg : 1;
+        bt.last_len = n - (bt.cnt - 1) * seg;
+        bt.final = eof;
+        if (idx * (seg / KEYBYTES) + (n + KEYBYTES - 1) / KEYBYTES > ((uint64_t)1 << 32))
+            hkx_abort(out, out_path, "encfile: input exceeds the 128 GiB HKX2 limit");
+        hkx2_seal_batch(&pool, &bt);
+        for (i = 0; i < bt.cnt; i++) {
+            fwrite(buf + i * seg, 1, i + 1 == bt.cnt ? bt.last_len : seg, out);
+            fwrite(tags + 32 * i, 1, 32, out);
+        }
+        idx += bt.cnt;
+    }
+    if (in != stdin) fclose(in);
+    par_pool_free(&pool);
+    if (fclose(out) != 0) dief("encfile: write error on %s", out_path);
+    explicit_bzero(buf, win * seg);
+    free(buf); free(tags);
+    explicit_bzero(&pre, sizeof pre);
+    explicit_bzero(&seed, sizeof seed); explicit_bzero(&base, sizeof base);
+    explicit_bzero(&mac_key_ba, sizeof mac_key_ba);
 }
 
-static void cmd_decfile(int argc, char **argv)
+/* Whole-file HKX1 decryption; raw holds the complete container. */
+static void decfile_hkx1(const BitArray *K, uint8_t *raw, size_t raw_len,
+                         const char *out_path)
 {
-    const char *algo     = get_arg(argc, argv, "--algo");
-    const char *key_path = get_arg(argc, argv, "--key");
-    const char *in_path  = get_arg(argc, argv, "--in");
-    const char *out_path = get_arg(argc, argv, "--out");
-    if (!algo)     algo = "hske-nla1";
-    if (!key_path) die("decfile: --key required");
-    if (!in_path)  die("decfile: --in required");
-    if (!out_path) die("decfile: --out required");
-    if (strcmp(algo, "hske-nla1") != 0)
-        dief("decfile: unsupported algorithm %s", algo);
-
-    BitArray K;
-    load_sym_key(&K, key_path);
-
-    size_t raw_len;
-    uint8_t *raw = read_binary_file(in_path, &raw_len);
-
-    /* Parse header */
     if (raw_len < 77) die("decfile: file too short to be a valid .hkx container");
-    if (raw[0]!='H'||raw[1]!='K'||raw[2]!='X'||raw[3]!='1')
-        die("decfile: invalid magic (expected HKX1)");
     if (raw[4] != 0x01) { char _ab[48]; snprintf(_ab,sizeof _ab,"decfile: unsupported algo byte 0x%02x",raw[4]); die(_ab); }
 
     uint64_t plaintext_len = 0;
@@ -3589,7 +3785,7 @@ static void cmd_decfile(int argc, char **argv)
     /* Derive base and seed */
     BitArray N_nonce, base, seed;
     ba_from_ra(&N_nonce, nonce_bytes, 32);
-    ba_xor(&base, &K, &N_nonce);
+    ba_xor(&base, K, &N_nonce);
     ba_rnl_kdf_seed(&seed, &base);
 
     /* Compute MAC and compare (verify-then-decrypt) */
@@ -3598,42 +3794,244 @@ static void cmd_decfile(int argc, char **argv)
     uint8_t mac_iv[32];
     { int j; for (j = 0; j < 32; j++) mac_iv[j] = mac_key_ba.b[j] ^ _HFSCX256_IV[j]; }
 
-    size_t mac_len = 32 + 8 + n_blocks * KEYBYTES;
-    uint8_t *mac_data = (uint8_t *)malloc(mac_len);
-    if (!mac_data) die("out of memory");
-    memcpy(mac_data, nonce_bytes, 32);
-    { int j; for (j = 0; j < 8; j++) mac_data[32+j] = raw[5+j]; }
-    if (n_blocks > 0) memcpy(mac_data + 40, ct_bytes, n_blocks * KEYBYTES);
+    /* nonce || pt_len || ct, hashed in place from the container */
+    HfscxCtx hc;
     uint8_t tag_computed[32];
-    hfscx_256(mac_data, mac_len, mac_iv, tag_computed);
-    free(mac_data);
+    hfscx_256_init(&hc, mac_iv);
+    hfscx_256_update(&hc, nonce_bytes, 32);
+    hfscx_256_update(&hc, raw + 5, 8);
+    hfscx_256_update(&hc, ct_bytes, n_blocks * KEYBYTES);
+    hfscx_256_final(&hc, tag_computed);
 
     /* Constant-time tag comparison */
-    uint8_t diff = 0;
-    { int j; for (j = 0; j < 32; j++) diff |= tag_stored[j] ^ tag_computed[j]; }
-    if (diff != 0) { free(raw); die("decfile: authentication tag mismatch — file corrupt or wrong key"); }
+    if (!ct_eq32(tag_stored, tag_computed)) { release_binary_file(raw); die("decfile: authentication tag mismatch — file corrupt or wrong key"); }
 
     /* Decrypt and write plaintext */
     size_t pt_len = (size_t)plaintext_len;
     uint8_t *plaintext = pt_len > 0 ? (uint8_t *)malloc(pt_len) : NULL;
     if (pt_len > 0 && !plaintext) die("out of memory");
-    {
-        size_t bi;
-        for (bi = 0; bi < n_blocks; bi++) {
-            BitArray ks;
-            hske_nla1_ks_block(&seed, &base, (uint32_t)bi, &ks);
-            size_t chunk = pt_len - bi * KEYBYTES;
-            if (chunk > KEYBYTES) chunk = KEYBYTES;
-            int j;
-            for (j = 0; j < (int)chunk; j++)
-                plaintext[bi * KEYBYTES + j] = ct_bytes[bi * KEYBYTES + j] ^ ks.b[j];
-        }
-    }
-    free(raw);
+    if (pt_len > 0) hske_nla1_xor_ks(&seed, &base, 0, ct_bytes, pt_len, plaintext);
+    release_binary_file(raw);
     write_binary_file(out_path, plaintext ? plaintext : (const uint8_t *)"", pt_len);
     free(plaintext);
 }
 
+/* Read exactly n bytes at offset pos; 0 on error or if the file ends first. */
+static int hkx_pread(int fd, uint8_t *buf, size_t n, uint64_t pos)
+{
+    while (n > 0) {
+        ssize_t r = pread(fd, buf, n, (off_t)pos);
+        if (r < 0 && errno == EINTR) continue;
+        if (r <= 0) return 0;
+        buf += r; n -= (size_t)r; pos += (uint64_t)r;
+    }
+    return 1;
+}
+
+/* decfile --offset X [--length Y]: decrypt one byte range of an HKX2 file.
+ * Only the segments overlapping the range are read (pread into a private
+ * buffer, so the tag covers exactly the bytes decrypted), authenticated and
+ * decrypted.  The range is clipped
+ * at the end of the plaintext; a read that stops short of the last segment
+ * cannot see a truncation after it.  An empty range still authenticates the
+ * segment holding X, so a wrong key or a corrupt file never exits 0. */
+static void decfile_range(const BitArray *K, const char *in_path,
+                          const char *out_path, uint64_t off,
+                          uint64_t want, int nthreads)
+{
+    struct stat st;
+    uint8_t hdr[HKX2_HDR_LEN];
+    int fd = strcmp(in_path, "-") == 0 ? -1 : open(in_path, O_RDONLY);
+    if (fd < 0 || fstat(fd, &st) != 0 || !S_ISREG(st.st_mode))
+        dief("decfile: --offset/--length need a regular --in file: %s", in_path);
+    if ((uint64_t)st.st_size < HKX2_HDR_LEN + 32 || !hkx_pread(fd, hdr, HKX2_HDR_LEN, 0))
+        die("decfile: file too short to be a valid .hkx container");
+
+    if (memcmp(hdr, "HKX2", 4) != 0)
+        die("decfile: --offset/--length need an HKX2 container");
+    if (hdr[4] != 0x01) { char _ab[48]; snprintf(_ab,sizeof _ab,"decfile: unsupported algo byte 0x%02x",hdr[4]); die(_ab); }
+    uint32_t seg = 0;
+    { int j; for (j = 0; j < 4; j++) seg = (seg << 8) | hdr[5+j]; }
+    if (!hkx2_seg_size_ok(seg)) die("decfile: invalid HKX2 segment size");
+
+    /* Segment layout follows from the file size alone. */
+    size_t rec = (size_t)seg + 32;
+    uint64_t body = (uint64_t)st.st_size - HKX2_HDR_LEN;
+    uint64_t nseg = (body + rec - 1) / rec;
+    size_t last_rec = (size_t)(body - (nseg - 1) * rec);
+    if (last_rec < 32) die("decfile: file truncated (segment or auth tag missing)");
+    uint64_t total = body - 32 * nseg;
+    if ((total + KEYBYTES - 1) / KEYBYTES > ((uint64_t)1 << 32))
+        die("decfile: container exceeds the 128 GiB HKX2 limit");
+    if (off > total) die("decfile: --offset is past the end of the plaintext");
+    if (want > total - off) want = total - off;
+
+    BitArray N_nonce, base, seed, mac_key_ba;
+    HfscxCtx pre;
+    ba_from_ra(&N_nonce, hdr + 9, 32);
+    ba_xor(&base, K, &N_nonce);
+    ba_rnl_kdf_seed(&seed, &base);
+    hske_nla1_mac_key(&seed, &base, &mac_key_ba);
+    hkx2_tag_init(&pre, &mac_key_ba, &N_nonce, seg);
+
+    FILE *out = (strcmp(out_path, "-") == 0) ? stdout : fopen(out_path, "wb");
+    if (!out) dief("cannot write: %s", out_path);
+
+    size_t win = hkx_window(nthreads, rec);
+    uint8_t *buf = (uint8_t *)malloc(win * rec), *ok = (uint8_t *)malloc(win);
+    if (!buf || !ok) die("out of memory");
+    ParPool pool;
+    par_pool_init(&pool, (int)win);
+    Hkx2Batch bt;
+    memset(&bt, 0, sizeof bt);
+    bt.seed = &seed; bt.base = &base; bt.pre = &pre; bt.seg = seg;
+    bt.buf = buf; bt.stride = rec; bt.ok = ok;
+
+    uint64_t s = off / seg, s_end, pos = off;
+    if (s >= nseg) s = nseg - 1;             /* off == total on a boundary */
+    s_end = want ? (off + want - 1) / seg + 1 : s + 1;
+    while (s < s_end) {
+        size_t i, good;
+        bt.idx0 = s;
+        bt.cnt = (size_t)((s_end - s < win) ? s_end - s : win);
+        bt.final = s + bt.cnt == nseg;
+        bt.last_len = bt.final ? last_rec - 32 : seg;
+        if (!hkx_pread(fd, buf, (bt.cnt - 1) * rec + bt.last_len + 32,
+                       HKX2_HDR_LEN + s * rec))
+            hkx_abort(out, out_path, "decfile: read error or file truncated");
+        good = hkx2_open_batch(&pool, &bt);
+        if (good < bt.cnt)
+            hkx_abort(out, out_path, "decfile: authentication tag mismatch — file corrupt or wrong key");
+        for (i = 0; i < bt.cnt; i++) {
+            uint64_t seg0 = (s + i) * seg;
+            size_t a = (size_t)(pos - seg0), len = i + 1 == bt.cnt ? bt.last_len : seg;
+            size_t b = (off + want - seg0 < len) ? (size_t)(off + want - seg0) : len;
+            fwrite(buf + i * rec + a, 1, b - a, out);
+            pos = seg0 + b;
+        }
+        s += bt.cnt;
+    }
+    par_pool_free(&pool);
+    if (out != stdout && fclose(out) != 0) dief("decfile: write error on %s", out_path);
+    close(fd);
+    explicit_bzero(buf, win * rec);
+    free(buf); free(ok);
+    explicit_bzero(&pre, sizeof pre);
+    explicit_bzero(&seed, sizeof seed); explicit_bzero(&base, sizeof base);
+    explicit_bzero(&mac_key_ba, sizeof mac_key_ba);
+}
+
+static void cmd_decfile(int argc, char **argv)
+{
+    const char *algo     = get_arg(argc, argv, "--algo");
+    const char *key_path = get_arg(argc, argv, "--key");
+    const char *in_path  = get_arg(argc, argv, "--in");
+    const char *out_path = get_arg(argc, argv, "--out");
+    if (!algo)     algo = "hske-nla1";
+    if (!key_path) die("decfile: --key required");
+    if (!in_path)  die("decfile: --in required");
+    if (!out_path) die("decfile: --out required");
+    if (strcmp(algo, "hske-nla1") != 0)
+        dief("decfile: unsupported algorithm %s", algo);
+    int nthreads = get_threads(argc, argv);
+    const char *off_str = get_arg(argc, argv, "--offset");
+    const char *len_str = get_arg(argc, argv, "--length");
+
+    BitArray K;
+    load_sym_key(&K, key_path);
+
+    if (off_str || len_str) {
+        uint64_t off = 0, want = UINT64_MAX;
+        if (off_str && !parse_u64(off_str, &off))
+            die("decfile: --offset must be a non-negative byte count");
+        if (len_str && !parse_u64(len_str, &want))
+            die("decfile: --length must be a non-negative byte count");
+        decfile_range(&K, in_path, out_path, off, want, nthreads);
+        return;
+    }
+
+    FILE *in = (strcmp(in_path, "-") == 0) ? stdin : fopen(in_path, "rb");
+    if (!in) { fprintf(stderr, "cannot open: %s\n", in_path); exit(1); }
+
+    /* Parse header */
+    uint8_t hdr[HKX2_HDR_LEN];
+    if (fread(hdr, 1, 4, in) != 4)
+        die("decfile: file too short to be a valid .hkx container");
+    if (memcmp(hdr, "HKX1", 4) == 0) {
+        /* Read into the heap: the tag must cover the very bytes decrypted. */
+        size_t rest_len;
+        uint8_t *rest = read_binary_stream(in, &rest_len);
+        if (in != stdin) fclose(in);
+        uint8_t *raw = (uint8_t *)realloc(rest, rest_len + 4);
+        if (!raw) die("out of memory");
+        memmove(raw + 4, raw, rest_len);
+        memcpy(raw, hdr, 4);
+        decfile_hkx1(&K, raw, rest_len + 4, out_path);
+        return;
+    }
+    if (memcmp(hdr, "HKX2", 4) != 0)
+        die("decfile: invalid magic (expected HKX1 or HKX2)");
+    if (fread(hdr + 4, 1, HKX2_HDR_LEN - 4, in) != HKX2_HDR_LEN - 4)
+        die("decfile: file too short to be a valid .hkx container");
+    if (hdr[4] != 0x01) { char _ab[48]; snprintf(_ab,sizeof _ab,"decfile: unsupported algo byte 0x%02x",hdr[4]); die(_ab); }
+    uint32_t seg = 0;
+    { int j; for (j = 0; j < 4; j++) seg = (seg << 8) | hdr[5+j]; }
+    if (!hkx2_seg_size_ok(seg)) die("decfile: invalid HKX2 segment size");
+
+    BitArray N_nonce, base, seed, mac_key_ba;
+    HfscxCtx pre;
+    ba_from_ra(&N_nonce, hdr + 9, 32);
+    ba_xor(&base, &K, &N_nonce);
+    ba_rnl_kdf_seed(&seed, &base);
+    hske_nla1_mac_key(&seed, &base, &mac_key_ba);
+    hkx2_tag_init(&pre, &mac_key_ba, &N_nonce, seg);
+
+    FILE *out = (strcmp(out_path, "-") == 0) ? stdout : fopen(out_path, "wb");
+    if (!out) dief("cannot write: %s", out_path);
+
+    /* Verify each segment before releasing its plaintext, one segment per
+     * thread per window.  A segment shorter than seg_size+32, or the last
+     * one before EOF, must carry final=1. */
+    size_t rec = (size_t)seg + 32, win = hkx_window(nthreads, rec);
+    uint8_t *buf = (uint8_t *)malloc(win * rec), *ok = (uint8_t *)malloc(win);
+    if (!buf || !ok) die("out of memory");
+    ParPool pool;
+    par_pool_init(&pool, (int)win);
+    Hkx2Batch bt;
+    memset(&bt, 0, sizeof bt);
+    bt.seed = &seed; bt.base = &base; bt.pre = &pre; bt.seg = seg;
+    bt.buf = buf; bt.stride = rec; bt.ok = ok;
+    uint64_t idx = 0;
+    int eof = 0;
+    while (!eof) {
+        size_t n = hkx_read_window(in, buf, win * rec, &eof), i, good;
+        if (ferror(in)) hkx_abort(out, out_path, "decfile: read error");
+        bt.idx0 = idx;
+        bt.cnt = (n + rec - 1) / rec;
+        bt.last_len = n - (bt.cnt ? bt.cnt - 1 : 0) * rec;
+        if (bt.cnt == 0 || bt.last_len < 32)
+            hkx_abort(out, out_path, "decfile: file truncated (segment or auth tag missing)");
+        bt.last_len -= 32;
+        bt.final = eof;
+        if (idx * (seg / KEYBYTES) + (n - 32 * bt.cnt + KEYBYTES - 1) / KEYBYTES > ((uint64_t)1 << 32))
+            hkx_abort(out, out_path, "decfile: container exceeds the 128 GiB HKX2 limit");
+        good = hkx2_open_batch(&pool, &bt);
+        for (i = 0; i < good; i++)
+            fwrite(buf + i * rec, 1, i + 1 == bt.cnt ? bt.last_len : seg, out);
+        if (good < bt.cnt)
+            hkx_abort(out, out_path, "decfile: authentication tag mismatch — file corrupt or wrong key");
+        idx += bt.cnt;
+    }
+    if (in != stdin) fclose(in);
+    par_pool_free(&pool);
+    if (out != stdout && fclose(out) != 0) dief("decfile: write error on %s", out_path);
+    explicit_bzero(buf, win * rec);
+    free(buf); free(ok);
+    explicit_bzero(&pre, sizeof pre);
+    explicit_bzero(&seed, sizeof seed); explicit_bzero(&base, sizeof base);
+    explicit_bzero(&mac_key_ba, sizeof mac_key_ba);
+}
+
 /* ─────────────────────────────────────────────────────────────────────────────
  * fpe — format-preserving encrypt / decrypt (78.A)
  *   --encrypt | --decrypt  --key SK --context CTX --in FILE [--out FILE]
@@ -3660,7 +4058,7 @@ static void cmd_fpe(int argc, char **argv)
     uint8_t *in_buf = read_binary_file(in_path, &in_len);
     BitArray P;
     make_msg_ba(&P, in_buf, in_len);
-    free(in_buf);
+    release_binary_file(in_buf);
 
     BitArray R;
     if (do_enc)
@@ -3699,7 +4097,7 @@ static void cmd_twk(int argc, char **argv)
     uint8_t *in_buf = read_binary_file(in_path, &in_len);
     BitArray P;
     make_msg_ba(&P, in_buf, in_len);
-    free(in_buf);
+    release_binary_file(in_buf);
 
     BitArray R;
     if (do_enc)
@@ -3720,16 +4118,14 @@ static void cmd_oprf_blind(int argc, char **argv)
     const char *out_path = get_arg(argc, argv, "--out");
     if (!in_path) die("oprf-blind: --in required");
 
-    FILE *urnd = fopen("/dev/urandom", "rb");
-    if (!urnd) die("cannot open /dev/urandom");
+    FILE *urnd = HERRADURA_OS_RNG;
 
     size_t in_len;
     uint8_t *in_buf = read_binary_file(in_path, &in_len);
 
     BitArray r, alpha;
     oprf_blind(in_buf, in_len, &r, &alpha, urnd);
-    free(in_buf);
-    fclose(urnd);
+    release_binary_file(in_buf);
 
     /* CLIENT STATE: SEQUENCE(INTEGER(r), INTEGER(alpha), INTEGER(256)) */
     uint8_t ir[DER_INT_LEN(KEYBYTES)], ialpha[DER_INT_LEN(KEYBYTES)], in[8];
@@ -3861,12 +4257,10 @@ static void cmd_pake_register(int argc, char **argv)
     pem_key_free(&kpem);
 
     const char *pw = pw_arg ? pw_arg : "demo-password";
-    FILE *urnd = fopen("/dev/urandom", "rb");
-    if (!urnd) die("cannot open /dev/urandom");
+    FILE *urnd = HERRADURA_OS_RNG;
 
     HpakeRecord rec;
     hpake_register(&rec, (const uint8_t *)pw, strlen(pw), &oprf_k, urnd);
-    fclose(urnd);
     explicit_bzero(&oprf_k, sizeof(oprf_k));
 
     /* Encode: SEQUENCE(INTEGER(salt,32), INTEGER(B,4), INTEGER(y,4)) */
@@ -3897,8 +4291,7 @@ static void cmd_pake_demo(int argc, char **argv)
     pem_key_free(&kpem);
 
     const char *pw = pw_arg ? pw_arg : "demo-password";
-    FILE *urnd = fopen("/dev/urandom", "rb");
-    if (!urnd) die("cannot open /dev/urandom");
+    FILE *urnd = HERRADURA_OS_RNG;
 
     HpakeRecord rec;
     hpake_register(&rec, (const uint8_t *)pw, strlen(pw), &oprf_k, urnd);
@@ -3912,7 +4305,6 @@ static void cmd_pake_demo(int argc, char **argv)
     } else {
         puts("+ aPAKE login failed!");
         explicit_bzero(&oprf_k, sizeof(oprf_k));
-        fclose(urnd);
         exit(1);
     }
 
@@ -3925,7 +4317,6 @@ static void cmd_pake_demo(int argc, char **argv)
     explicit_bzero(&oprf_k, sizeof(oprf_k));
     explicit_bzero(sk,  sizeof(sk));
     explicit_bzero(sk2, sizeof(sk2));
-    fclose(urnd);
 }
 
 /* ─────────────────────────────────────────────────────────────────────────────
@@ -4150,13 +4541,11 @@ static void cmd_cred_issue(int argc, char **argv)
     ba_from_ra(&issuer_seed_ba, issuer_k.vals[1], issuer_k.vlens[1]);
     pem_key_free(&issuer_k);
 
-    FILE *urnd = fopen("/dev/urandom", "rb");
-    if (!urnd) die("cannot open /dev/urandom");
+    FILE *urnd = HERRADURA_OS_RNG;
 
     SternSig sig;
     hcred_issue(&sig, m_poly, C_poly, &seed_H_ba, syndr,
                 &issuer_e_ba, &issuer_seed_ba, urnd);
-    fclose(urnd);
 
     stern_sig_write_label(&sig, PEM_HCRED_CRED, out_path);
 }
@@ -4188,14 +4577,12 @@ static void cmd_cred_prove(int argc, char **argv)
     const uint8_t *msg     = msg_arg ? (const uint8_t *)msg_arg : (const uint8_t *)"";
     size_t          msg_len = msg_arg ? strlen(msg_arg) : 0;
 
-    FILE *urnd = fopen("/dev/urandom", "rb");
-    if (!urnd) die("cannot open /dev/urandom");
+    FILE *urnd = HERRADURA_OS_RNG;
 
     HcredProof proof;
     memset(&proof, 0, sizeof(proof));
     int r = hcred_prove(&proof, s_poly, m_poly, C_poly, &seed_H_ba, syndr,
                          rounds, msg, msg_len, urnd);
-    fclose(urnd);
 
     if (r == -1) die("cred-prove: hcred_prove failed (memory)");
     if (r == -2) die("cred-prove: hcred_prove failed (witness check: bad key or syndrome)");
@@ -4335,11 +4722,17 @@ static void usage(void)
 "    Decrypt.  Symmetric: key=SESSION KEY PEM.  Asymmetric: key=PRIVATE KEY PEM.\n"
 "    AEAD ciphertexts (format tag 2) are verified before decryption.\n"
 "\n"
-"  encfile --algo hske-nla1 --key SK --in FILE --out FILE.hkx\n"
+"  encfile --algo hske-nla1 --key SK --in FILE --out FILE.hkx [--chunk BYTES] [--threads N]\n"
 "    Stream-encrypt an arbitrary-size file (HSKE-NL-A1 CTR-AEAD).\n"
+"    --threads N splits the CTR keystream across N threads (0 = every CPU);\n"
+"    the output does not depend on N.\n"
 "\n"
-"  decfile --algo hske-nla1 --key SK --in FILE.hkx --out FILE\n"
+"  decfile --algo hske-nla1 --key SK --in FILE.hkx --out FILE [--threads N]\n"
+"          [--offset X] [--length Y]\n"
 "    Verify-then-decrypt a .hkx file.  Exits non-zero on auth failure.\n"
+"    --offset/--length decrypt only plaintext bytes [X, X+Y) of an HKX2 file,\n"
+"    authenticating just the segments that overlap the range (at least the\n"
+"    one holding X, so --length 0 still checks the key).\n"
 "\n"
 "  sign --algo ALGO --key PRIV --in FILE --out SIG [--digest hfscx-256] [--ring P0,P1,...]\n"
 "    Sign.  Algorithms: hpks hpks-nl hpks-stern rnl-sigma nl-zkboo nl-zkbpp hpks-wots hpks-xmss hpks-ring\n"
@@ -4354,6 +4747,12 @@ static void usage(void)
 "\n"
 "  verify --algo ALGO [--pubkey PUB | --ring P0,P1,...] --in FILE --sig SIG [--digest hfscx-256]\n"
 "    Verify signature.  Exits 0 on OK, 1 on failure.\n"
+"  verify --algo hpks --batch LIST [--digest hfscx-256]\n"
+"    Verify many HPKS signatures at once (random linear combination).\n"
+"    LIST lines: PUBKEY.pem MSGFILE SIG.pem ('#' comments allowed; '-' = stdin).\n"
+"    Prints 'Batch OK: N signatures' or 'Verification FAILED: entry K'.\n"
+"    One bad or malleated signature always fails the batch; errors planted on\n"
+"    several can cancel, so use plain verify where malleability matters.\n"
 "    rnl-sigma: pubkey = hkex-rnl public key; sig = ZKP-RNL PROOF PEM.\n"
 "    nl-zkboo:  pubkey = hpks-zkp-nl public key; sig = ZKP-NL PROOF PEM.\n"
 "    nl-zkbpp:  pubkey = hpks-zkp-nl public key; sig = ZKP-NL-PP SIGNATURE PEM (ZKB++).\n"
@@ -4379,10 +4778,12 @@ static void usage(void)
 "    With --out FILE: HERRADURA DIGEST PEM.\n"
 "\n"
 "  rand (--seed FILE | --state FILE) [--personalization STR] [--reseed FILE]\n"
-"       [--bytes N] [--hex] [--out FILE]\n"
+"       [--bytes N] [--hex] [--bulk] [--out FILE]\n"
 "    HDRBG deterministic byte generation (NOT an OS entropy source).\n"
 "    --seed instantiates; --state resumes/checkpoints a HERRADURA HDRBG STATE PEM.\n"
 "    Same seed+personalization+N is byte-identical across the Python/C/Go CLIs.\n"
+"    --bulk (C only): one ratchet per request, output from the HSKE-NL-A1\n"
+"    keystream; much faster for large N, but a different stream.\n"
 "\n"
 "  fpe (--encrypt|--decrypt) --key SK --context CTX --in FILE [--out FILE]\n"
 "    Format-preserving encrypt/decrypt a 32-byte block (78.A).\n"
@@ -3739,7 +3739,18 @@ func cmdVerify(args []string) {
 
 // ── encfile / decfile ────────────────────────────────────────────────────────
 //
-// Binary .hkx container format (HSKE-NL-A1 CTR-mode AEAD):
+// encfile writes the segmented HKX2 container; decfile reads HKX2 and HKX1.
+//
+// HKX2 (.hkx), streamed one segment at a time:
+//   [0:4]         Magic "HKX2"
+//   [4]           Algo byte: 0x01 = hske-nla1
+//   [5:9]         Segment size S (big-endian uint32; multiple of 32, ≤ 2^24)
+//   [9:41]        Nonce N (32 bytes)
+//   [41:]         Segments ct_i‖tag_i; every ct_i but the last is S bytes,
+//                 the last is 0..S bytes (empty file = one empty final segment)
+//   tag_i = HFSCX-256-MAC(mac_key, "HKX2-SEG"‖nonce‖S_be4‖i_be8‖final‖ct_i)
+//
+// HKX1 (.hkx), whole-file:
 //   [0:4]         Magic "HKX1"
 //   [4]           Algo byte: 0x01 = hske-nla1
 //   [5:13]        Plaintext length (big-endian uint64)
@@ -3747,7 +3758,7 @@ func cmdVerify(args []string) {
 //   [45:45+m*32]  Ciphertext blocks (m = ⌈len/32⌉; last block zero-padded)
 //   [45+m*32:]    Auth tag: HFSCX-256-MAC(mac_key, nonce‖len‖ciphertext)
 //
-// Keystream: ks_i = HskeNla1KsBlock(seed, base, i)
+// Keystream: ks_i = HskeNla1KsBlock(seed, base, i)  (i = global block counter)
 // MAC key:   HskeNla1MacKey(seed, base)  [domain-separated via inner ROL]
 // MAC IV:    mac_key XOR Hfscx256IV
 //
@@ -3755,18 +3766,73 @@ func cmdVerify(args []string) {
 
 const (
 	hkxMagic    = "HKX1"
+	hkx2Magic   = "HKX2"
 	hkxAlgoNLA1 = byte(0x01)
 	hkxHdrSize  = 4 + 1 + 8 + 32 // magic + algo + len8 + nonce32 = 45
 	hkxBlock    = 32
 	hkxMinSize  = hkxHdrSize + hkxBlock // 45 + 32-byte tag (0-byte plaintext)
+	hkx2HdrSize = 4 + 1 + 4 + 32 // magic + algo + seg4 + nonce32 = 41
+	hkx2SegDS   = "HKX2-SEG"
+	hkx2SegDef  = 65536
+	hkx2SegMax  = 1 << 24
+	hkx2BlkLim  = uint64(1) << 32 // keystream counter limit (128 GiB)
 )
 
+func hkx2SegSizeOK(seg int) bool {
+	return seg >= hkxBlock && seg <= hkx2SegMax && seg%hkxBlock == 0
+}
+
+// hkxSchedule derives (base, seed, mac_iv) for one (key, nonce) pair.
+func hkxSchedule(keyInt *big.Int, nonce *BitArray) (*BitArray, *BitArray, []byte) {
+	n := 256
+	K    := NewBitArray(n, keyInt)
+	base := NewBitArray(n, new(big.Int).Xor(&K.Val, &nonce.Val))
+	seed := RnlKdfSeed(base) // ROL(base, n/8) XOR DC
+	macKey  := HskeNla1MacKey(seed, base)
+	ivConst := new(big.Int).SetBytes(Hfscx256IV[:])
+	macIV   := NewBitArray(n, new(big.Int).Xor(&macKey.Val, ivConst))
+	return base, seed, macIV.Bytes()
+}
+
+// hkxXorKs XORs the keystream into buf in place, starting at block blk0.
+func hkxXorKs(seed, base *BitArray, blk0 uint64, buf []byte) {
+	for off := 0; off < len(buf); off += hkxBlock {
+		ksBytes := HskeNla1KsBlock(seed, base, uint32(blk0+uint64(off/hkxBlock))).Bytes()
+		for j := 0; j < hkxBlock && off+j < len(buf); j++ {
+			buf[off+j] ^= ksBytes[j]
+		}
+	}
+}
+
+func hkx2SegTag(macIV, prefix []byte, idx uint64, final bool, ct []byte) []byte {
+	macData := make([]byte, 0, len(prefix)+9+len(ct))
+	macData  = append(macData, prefix...)
+	macData  = binary.BigEndian.AppendUint64(macData, idx)
+	if final {
+		macData = append(macData, 1)
+	} else {
+		macData = append(macData, 0)
+	}
+	macData = append(macData, ct...)
+	return Hfscx256(macData, macIV)
+}
+
+// readUpTo fills buf from r and returns the byte count; a short count means EOF.
+func readUpTo(r io.Reader, buf []byte) (int, error) {
+	n, err := io.ReadFull(r, buf)
+	if err == io.EOF || err == io.ErrUnexpectedEOF {
+		err = nil
+	}
+	return n, err
+}
+
 func cmdEncfile(args []string) {
 	fs := flag.NewFlagSet("encfile", flag.ExitOnError)
-	algo := fs.String("algo", "hske-nla1", "Encryption algorithm (hske-nla1)")
-	key  := fs.String("key", "", "Session key file")
-	in   := fs.String("in", "-", "Plaintext input file")
-	out  := fs.String("out", "-", "Output .hkx file")
+	algo  := fs.String("algo", "hske-nla1", "Encryption algorithm (hske-nla1)")
+	key   := fs.String("key", "", "Session key file")
+	in    := fs.String("in", "-", "Plaintext input file")
+	out   := fs.String("out", "-", "Output .hkx file")
+	chunk := fs.Int("chunk", hkx2SegDef, "HKX2 segment size in bytes (multiple of 32)")
 	fs.Parse(args)
 
 	if *algo != "hske-nla1" {
@@ -3777,6 +3843,11 @@ func cmdEncfile(args []string) {
 		fmt.Fprintln(os.Stderr, "encfile: --key required")
 		os.Exit(1)
 	}
+	seg := *chunk
+	if !hkx2SegSizeOK(seg) {
+		fmt.Fprintln(os.Stderr, "encfile: --chunk must be a multiple of 32 between 32 and 16777216")
+		os.Exit(1)
+	}
 
 	keyInt, nbits, err := loadKey(*key)
 	if err != nil {
@@ -3787,61 +3858,123 @@ func cmdEncfile(args []string) {
 		os.Exit(1)
 	}
 
-	plaintext, err := readFile(*in)
-	if err != nil {
-		die("encfile", err)
+	fin := os.Stdin
+	if *in != "-" {
+		if fin, err = os.Open(*in); err != nil {
+			die("encfile", err)
+		}
+		defer fin.Close()
+	}
+	fout := os.Stdout
+	if *out != "-" {
+		if fout, err = os.Create(*out); err != nil {
+			die("encfile", err)
+		}
+	}
+	// fail removes the partial output before exiting
+	fail := func(msg string) {
+		if fout != os.Stdout {
+			fout.Close()
+			os.Remove(*out)
+		}
+		fmt.Fprintln(os.Stderr, msg)
+		os.Exit(1)
+	}
+
+	nonce := NewRandBitArray(256)
+	nonceBytes := nonce.Bytes()
+	base, seed, macIV := hkxSchedule(keyInt, nonce)
+	segBytes := binary.BigEndian.AppendUint32(nil, uint32(seg))
+	prefix := append(append([]byte(hkx2SegDS), nonceBytes...), segBytes...)
+
+	hdr := append([]byte(hkx2Magic), hkxAlgoNLA1)
+	hdr  = append(append(hdr, segBytes...), nonceBytes...)
+	if _, err := fout.Write(hdr); err != nil {
+		fail("encfile: " + err.Error())
 	}
-	ptLen := len(plaintext)
-	n := 256
 
-	K     := NewBitArray(n, keyInt)
-	nonce := NewRandBitArray(n)
-	base  := NewBitArray(n, new(big.Int).Xor(&K.Val, &nonce.Val))
-	seed  := RnlKdfSeed(base) // ROL(base, n/8) XOR DC
-
-	// Encrypt in hkxBlock-byte blocks (last block zero-padded if needed)
-	nBlocks := (ptLen + hkxBlock - 1) / hkxBlock
-	ctBuf   := make([]byte, nBlocks*hkxBlock)
-	for i := 0; i < nBlocks; i++ {
-		ks     := HskeNla1KsBlock(seed, base, uint32(i))
-		ksBytes := ks.Bytes()
-		off    := i * hkxBlock
-		for j := 0; j < hkxBlock; j++ {
-			pb := byte(0)
-			if off+j < ptLen {
-				pb = plaintext[off+j]
+	// Look one segment ahead so the last one is tagged final
+	cur, nxt := make([]byte, seg), make([]byte, seg)
+	nCur, err := readUpTo(fin, cur)
+	if err != nil {
+		fail("encfile: " + err.Error())
+	}
+	for idx := uint64(0); ; idx++ {
+		nNxt := 0
+		if nCur == seg {
+			if nNxt, err = readUpTo(fin, nxt); err != nil {
+				fail("encfile: " + err.Error())
 			}
-			ctBuf[off+j] = pb ^ ksBytes[j]
+		}
+		blk0 := idx * uint64(seg/hkxBlock)
+		if blk0+uint64((nCur+hkxBlock-1)/hkxBlock) > hkx2BlkLim {
+			fail("encfile: input exceeds the 128 GiB HKX2 limit")
+		}
+		ct := cur[:nCur]
+		hkxXorKs(seed, base, blk0, ct)
+		tag := hkx2SegTag(macIV, prefix, idx, nNxt == 0, ct)
+		if _, err := fout.Write(append(ct, tag...)); err != nil {
+			fail("encfile: " + err.Error())
+		}
+		if nNxt == 0 {
+			break
+		}
+		cur, nxt = nxt, cur
+		nCur = nNxt
+	}
+	if fout != os.Stdout {
+		if err := fout.Close(); err != nil {
+			os.Remove(*out)
+			die("encfile", err)
 		}
 	}
+}
 
-	// MAC key (domain-separated from encryption by inner RotateLeft(64))
-	macKey := HskeNla1MacKey(seed, base)
-	ivConst := new(big.Int).SetBytes(Hfscx256IV[:])
-	macIV  := NewBitArray(n, new(big.Int).Xor(&macKey.Val, ivConst))
+// decfileHkx1 verifies and decrypts a whole-file HKX1 container.
+func decfileHkx1(keyInt *big.Int, raw []byte) []byte {
+	if len(raw) < hkxMinSize {
+		fmt.Fprintln(os.Stderr, "decfile: file too short to be a valid .hkx container")
+		os.Exit(1)
+	}
+	if raw[4] != hkxAlgoNLA1 {
+		fmt.Fprintf(os.Stderr, "decfile: unsupported algo byte 0x%02x\n", raw[4])
+		os.Exit(1)
+	}
 
-	// Auth tag: HFSCX-256-MAC over nonce || plaintext_len || ciphertext
-	nonceBytes := nonce.Bytes()
-	lenBytes    := make([]byte, 8)
-	binary.BigEndian.PutUint64(lenBytes, uint64(ptLen))
-	macData := make([]byte, 0, len(nonceBytes)+8+len(ctBuf))
-	macData  = append(macData, nonceBytes...)
-	macData  = append(macData, lenBytes...)
-	macData  = append(macData, ctBuf...)
-	tag := Hfscx256(macData, macIV.Bytes())
-
-	// Assemble .hkx output
-	out_ := make([]byte, 0, hkxHdrSize+len(ctBuf)+hkxBlock)
-	out_  = append(out_, []byte(hkxMagic)...)
-	out_  = append(out_, hkxAlgoNLA1)
-	out_  = append(out_, lenBytes...)
-	out_  = append(out_, nonceBytes...)
-	out_  = append(out_, ctBuf...)
-	out_  = append(out_, tag...)
-
-	if err := writeBytes(*out, out_); err != nil {
-		die("encfile", err)
+	ptLen    := int(binary.BigEndian.Uint64(raw[5:13]))
+	nonceBuf := raw[13:45]
+	nBlocks  := (ptLen + hkxBlock - 1) / hkxBlock
+	ctEnd    := hkxHdrSize + nBlocks*hkxBlock
+
+	if len(raw) < ctEnd+hkxBlock {
+		fmt.Fprintln(os.Stderr, "decfile: file truncated (ciphertext blocks or auth tag missing)")
+		os.Exit(1)
 	}
+
+	ctBytes   := raw[hkxHdrSize:ctEnd]
+	tagStored := raw[ctEnd : ctEnd+hkxBlock]
+
+	nonce := NewBitArray(256, new(big.Int).SetBytes(nonceBuf))
+	base, seed, macIV := hkxSchedule(keyInt, nonce)
+
+	// Recompute MAC and verify before decrypting (verify-then-decrypt)
+	lenBuf  := make([]byte, 8)
+	binary.BigEndian.PutUint64(lenBuf, uint64(ptLen))
+	macData := make([]byte, 0, len(nonceBuf)+8+len(ctBytes))
+	macData  = append(macData, nonceBuf...)
+	macData  = append(macData, lenBuf...)
+	macData  = append(macData, ctBytes...)
+	tagComputed := Hfscx256(macData, macIV)
+
+	if subtle.ConstantTimeCompare(tagStored, tagComputed) != 1 {
+		fmt.Fprintln(os.Stderr, "decfile: authentication tag mismatch — file corrupt or wrong key")
+		os.Exit(1)
+	}
+
+	// Decrypt and trim to exact plaintext length
+	plaintext := append([]byte(nil), ctBytes[:ptLen]...)
+	hkxXorKs(seed, base, 0, plaintext)
+	return plaintext
 }
 
 func cmdDecfile(args []string) {
@@ -3870,75 +4003,109 @@ func cmdDecfile(args []string) {
 		os.Exit(1)
 	}
 
-	raw, err := readFile(*in)
-	if err != nil {
-		die("decfile", err)
+	fin := os.Stdin
+	if *in != "-" {
+		if fin, err = os.Open(*in); err != nil {
+			die("decfile", err)
+		}
+		defer fin.Close()
 	}
 
 	// Validate header
-	if len(raw) < hkxMinSize {
+	hdr := make([]byte, hkx2HdrSize)
+	if n, err := readUpTo(fin, hdr[:4]); err != nil || n < 4 {
 		fmt.Fprintln(os.Stderr, "decfile: file too short to be a valid .hkx container")
 		os.Exit(1)
 	}
-	if string(raw[:4]) != hkxMagic {
-		fmt.Fprintf(os.Stderr, "decfile: invalid magic %q (expected %q)\n", raw[:4], hkxMagic)
+	if string(hdr[:4]) == hkxMagic {
+		rest, err := io.ReadAll(fin)
+		if err != nil {
+			die("decfile", err)
+		}
+		if err := writeBytes(*out, decfileHkx1(keyInt, append(hdr[:4], rest...))); err != nil {
+			die("decfile", err)
+		}
+		return
+	}
+	if string(hdr[:4]) != hkx2Magic {
+		fmt.Fprintf(os.Stderr, "decfile: invalid magic %q (expected %q or %q)\n", hdr[:4], hkxMagic, hkx2Magic)
 		os.Exit(1)
 	}
-	if raw[4] != hkxAlgoNLA1 {
-		fmt.Fprintf(os.Stderr, "decfile: unsupported algo byte 0x%02x\n", raw[4])
+	if n, err := readUpTo(fin, hdr[4:]); err != nil || n < hkx2HdrSize-4 {
+		fmt.Fprintln(os.Stderr, "decfile: file too short to be a valid .hkx container")
 		os.Exit(1)
 	}
-
-	ptLen    := int(binary.BigEndian.Uint64(raw[5:13]))
-	nonceBuf := raw[13:45]
-	nBlocks  := (ptLen + hkxBlock - 1) / hkxBlock
-	ctEnd    := hkxHdrSize + nBlocks*hkxBlock
-
-	if len(raw) < ctEnd+hkxBlock {
-		fmt.Fprintln(os.Stderr, "decfile: file truncated (ciphertext blocks or auth tag missing)")
+	if hdr[4] != hkxAlgoNLA1 {
+		fmt.Fprintf(os.Stderr, "decfile: unsupported algo byte 0x%02x\n", hdr[4])
 		os.Exit(1)
 	}
-
-	ctBytes   := raw[hkxHdrSize:ctEnd]
-	tagStored := raw[ctEnd : ctEnd+hkxBlock]
-
-	n := 256
-	K     := NewBitArray(n, keyInt)
-	nonce := NewBitArray(n, new(big.Int).SetBytes(nonceBuf))
-	base  := NewBitArray(n, new(big.Int).Xor(&K.Val, &nonce.Val))
-	seed  := RnlKdfSeed(base) // ROL(base, n/8) XOR DC
-
-	// Recompute MAC and verify before decrypting (verify-then-decrypt)
-	macKey  := HskeNla1MacKey(seed, base)
-	ivConst := new(big.Int).SetBytes(Hfscx256IV[:])
-	macIV   := NewBitArray(n, new(big.Int).Xor(&macKey.Val, ivConst))
-	lenBuf  := make([]byte, 8)
-	binary.BigEndian.PutUint64(lenBuf, uint64(ptLen))
-	macData := make([]byte, 0, len(nonceBuf)+8+len(ctBytes))
-	macData  = append(macData, nonceBuf...)
-	macData  = append(macData, lenBuf...)
-	macData  = append(macData, ctBytes...)
-	tagComputed := Hfscx256(macData, macIV.Bytes())
-
-	if subtle.ConstantTimeCompare(tagStored, tagComputed) != 1 {
-		fmt.Fprintln(os.Stderr, "decfile: authentication tag mismatch — file corrupt or wrong key")
+	seg := int(binary.BigEndian.Uint32(hdr[5:9]))
+	if !hkx2SegSizeOK(seg) {
+		fmt.Fprintln(os.Stderr, "decfile: invalid HKX2 segment size")
 		os.Exit(1)
 	}
+	nonce := NewBitArray(256, new(big.Int).SetBytes(hdr[9:41]))
+	base, seed, macIV := hkxSchedule(keyInt, nonce)
+	prefix := append([]byte(hkx2SegDS), hdr[9:41]...)
+	prefix  = append(prefix, hdr[5:9]...)
 
-	// Decrypt and trim to exact plaintext length
-	plaintext := make([]byte, nBlocks*hkxBlock)
-	for i := 0; i < nBlocks; i++ {
-		cBlk    := ctBytes[i*hkxBlock : (i+1)*hkxBlock]
-		ks      := HskeNla1KsBlock(seed, base, uint32(i))
-		ksBytes := ks.Bytes()
-		off     := i * hkxBlock
-		for j := 0; j < hkxBlock; j++ {
-			plaintext[off+j] = cBlk[j] ^ ksBytes[j]
+	fout := os.Stdout
+	if *out != "-" {
+		if fout, err = os.Create(*out); err != nil {
+			die("decfile", err)
 		}
 	}
+	// fail removes the partial output before exiting
+	fail := func(msg string) {
+		if fout != os.Stdout {
+			fout.Close()
+			os.Remove(*out)
+		}
+		fmt.Fprintln(os.Stderr, msg)
+		os.Exit(1)
+	}
 
-	if err := writeBytes(*out, plaintext[:ptLen]); err != nil {
-		die("decfile", err)
+	// Verify each segment before releasing its plaintext
+	rec := seg + hkxBlock
+	cur, nxt := make([]byte, rec), make([]byte, rec)
+	nCur, err := readUpTo(fin, cur)
+	if err != nil {
+		fail("decfile: " + err.Error())
+	}
+	for idx := uint64(0); ; idx++ {
+		if nCur < hkxBlock {
+			fail("decfile: file truncated (segment or auth tag missing)")
+		}
+		nNxt := 0
+		if nCur == rec {
+			if nNxt, err = readUpTo(fin, nxt); err != nil {
+				fail("decfile: " + err.Error())
+			}
+		}
+		ct  := cur[:nCur-hkxBlock]
+		tag := hkx2SegTag(macIV, prefix, idx, nNxt == 0, ct)
+		if subtle.ConstantTimeCompare(cur[nCur-hkxBlock:nCur], tag) != 1 {
+			fail("decfile: authentication tag mismatch — file corrupt or wrong key")
+		}
+		blk0 := idx * uint64(seg/hkxBlock)
+		if blk0+uint64((len(ct)+hkxBlock-1)/hkxBlock) > hkx2BlkLim {
+			fail("decfile: container exceeds the 128 GiB HKX2 limit")
+		}
+		hkxXorKs(seed, base, blk0, ct)
+		if _, err := fout.Write(ct); err != nil {
+			fail("decfile: " + err.Error())
+		}
+		if nNxt == 0 {
+			break
+		}
+		cur, nxt = nxt, cur
+		nCur = nNxt
+	}
+	if fout != os.Stdout {
+		if err := fout.Close(); err != nil {
+			os.Remove(*out)
+			die("decfile", err)
+		}
 	}
 }
 
@@ -4287,7 +4454,7 @@ Commands:
   dec      --algo ALGO --key FILE --in FILE [--out FILE]
   sign     --algo ALGO --key FILE --in FILE [--digest hfscx-256] [--out FILE]
   verify   --algo ALGO --pubkey FILE --in FILE --sig FILE [--digest hfscx-256]
-  encfile  --key FILE --in FILE --out FILE
+  encfile  --key FILE --in FILE --out FILE [--chunk BYTES]
   decfile  --key FILE --in FILE --out FILE
   dgst     [--algo hfscx-256] --in FILE [--out FILE]
   rand     (--seed FILE | --state FILE) [--personalization STR] [--reseed FILE] [--bytes N] [--hex] [--out FILE]
@@ -110,9 +110,21 @@ static void op_gf_mul(const BitArray *secret, const BitArray *pub)
 static void op_gf_pow(const BitArray *secret, const BitArray *pub)
 { BitArray d; gf_pow_ba(&d, pub, secret); }
 
+/* gf_pow_win_ba reads its per-base window table with gf_ct_lookup (full scan,
+ * masked); gf_pow_gen_ba does the same over the static GF_GEN table. */
+static void op_gf_pow_win(const BitArray *secret, const BitArray *pub)
+{ BitArray d; gf_pow_win_ba(&d, pub, secret); }
+
+static void op_gf_pow_gen(const BitArray *secret, const BitArray *pub)
+{ BitArray d; (void)pub; gf_pow_gen_ba(&d, secret); }
+
 static void op_mul_mod_ord(const BitArray *secret, const BitArray *pub)
 { BitArray d; ba_mul_mod_ord(&d, secret, pub); }
 
+/* ba_modinv_ord is a^(λ-1) over a fixed public exponent (oprf_blind's r). */
+static void op_modinv_ord(const BitArray *secret, const BitArray *pub)
+{ BitArray d; (void)pub; ba_modinv_ord(&d, secret); }
+
 static void op_fscx_revolve(const BitArray *secret, const BitArray *pub)
 { BitArray d; ba_fscx_revolve(&d, pub, secret, I_VALUE); }
 
@@ -244,7 +256,10 @@ int main(int argc, char **argv)
 
     run_test("gf_mul_ba (secret=operand a)",      rounds, setup_zero, setup_rand, op_gf_mul,        urnd);
     run_test("gf_pow_ba (secret=exponent)",        rounds, setup_zero, setup_rand, op_gf_pow,        urnd);
+    run_test("gf_pow_win_ba (secret=exponent)",    rounds, setup_zero, setup_rand, op_gf_pow_win,    urnd);
+    run_test("gf_pow_gen_ba (secret=exponent)",    rounds, setup_zero, setup_rand, op_gf_pow_gen,    urnd);
     run_test("ba_mul_mod_ord (secret=operand a)",  rounds, setup_zero, setup_rand, op_mul_mod_ord,   urnd);
+    run_test("ba_modinv_ord (secret=operand a)",   rounds, setup_zero, setup_rand, op_modinv_ord,    urnd);
     run_test("ba_fscx_revolve (secret=key operand)", rounds, setup_zero, setup_rand, op_fscx_revolve, urnd);
     run_test("stern_gen_perm (secret=pi_seed)",      rounds, setup_zero, setup_rand, op_stern_gen_perm,   urnd);
     run_test("stern_apply_perm (secret=pi_seed)",    rounds, setup_zero, setup_rand, op_stern_apply_perm, urnd);
@@ -130,6 +130,49 @@ func HpksVerify(msg, pub, R, s []byte) (bool, error) {
 	return C.hffi_hpks_verify(cptr(msg), cptr(pub), cptr(R), cptr(s)) != 0, nil
 }
 
+// hffiVerifyBatch calls the shim on n packed records and returns its result
+// (1, 0, or -1 when the C side runs out of memory) and the bad index. Tests
+// replace it to reach the -1 path.
+var hffiVerifyBatch = func(msgs, pubs, Rs, ss []byte, n int) (int, int) {
+	var bad C.size_t
+	rc := C.hffi_hpks_verify_batch(cptr(msgs), cptr(pubs), cptr(Rs), cptr(ss),
+		C.size_t(n), &bad)
+	return int(rc), int(bad)
+}
+
+// HpksVerifyBatch verifies n Schnorr signatures at once (random linear
+// combination; see hpks_verify_batch in herradura.h). On failure badIdx is
+// the index of the first signature that fails HpksVerify. If the C side
+// cannot allocate its work buffers the batch is not verified: ok is false
+// and err is set.
+func HpksVerifyBatch(msgs, pubs, Rs, ss [][]byte) (ok bool, badIdx int, err error) {
+	n := len(msgs)
+	if len(pubs) != n || len(Rs) != n || len(ss) != n {
+		return false, 0, fmt.Errorf("herraduraffi: batch slices differ in length")
+	}
+	if n == 0 {
+		return true, 0, nil
+	}
+	cols := [4][]byte{}
+	for c, in := range [4][][]byte{msgs, pubs, Rs, ss} {
+		cols[c] = make([]byte, 0, n*KeyBytes)
+		for _, b := range in {
+			if err = checkLen("batch item", b); err != nil {
+				return false, 0, err
+			}
+			cols[c] = append(cols[c], b...)
+		}
+	}
+	rc, bad := hffiVerifyBatch(cols[0], cols[1], cols[2], cols[3], n)
+	switch {
+	case rc == 1:
+		return true, 0, nil
+	case rc < 0:
+		return false, 0, fmt.Errorf("herraduraffi: hpks_verify_batch: out of memory")
+	}
+	return false, bad, nil
+}
+
 // HpkeEncrypt encrypts pt for the holder of the private key matching pub.
 // Returns (nil, nil, nil) if pub is a degenerate public key.
 func HpkeEncrypt(pt, pub []byte) (R, ct []byte, err error) {
@@ -35,6 +35,20 @@ func TestRoundTrips(t *testing.T) {
 		t.Fatalf("HPKS signature failed to verify")
 	}
 
+	var msgs, pubs, Rs, ss [][]byte
+	for i := 0; i < 4; i++ {
+		m, _ := RandomBytes()
+		Ri, si, _ := HpksSign(m, aPriv)
+		msgs, pubs, Rs, ss = append(msgs, m), append(pubs, aPub), append(Rs, Ri), append(ss, si)
+	}
+	if ok, _, err := HpksVerifyBatch(msgs, pubs, Rs, ss); err != nil || !ok {
+		t.Fatalf("HPKS batch failed to verify: %v", err)
+	}
+	msgs[1], _ = RandomBytes()
+	if ok, bad, _ := HpksVerifyBatch(msgs, pubs, Rs, ss); ok || bad != 1 {
+		t.Fatalf("HPKS batch: tampered item not reported (ok=%v bad=%d)", ok, bad)
+	}
+
 	R2, ct2, err := HpkeEncrypt(pt, aPub)
 	if err != nil || R2 == nil {
 		t.Fatalf("HPKE encrypt failed: %v", err)
@@ -44,3 +58,18 @@ func TestRoundTrips(t *testing.T) {
 		t.Fatalf("HPKE roundtrip mismatch")
 	}
 }
+
+func TestHpksVerifyBatchOutOfMemory(t *testing.T) {
+	priv, _ := RandomBytes()
+	pub, _ := HkexGfPubkey(priv)
+	msg, _ := RandomBytes()
+	R, s, _ := HpksSign(msg, priv)
+
+	saved := hffiVerifyBatch
+	defer func() { hffiVerifyBatch = saved }()
+	hffiVerifyBatch = func(_, _, _, _ []byte, _ int) (int, int) { return -1, 0 }
+	ok, _, err := HpksVerifyBatch([][]byte{msg}, [][]byte{pub}, [][]byte{R}, [][]byte{s})
+	if ok || err == nil {
+		t.Fatalf("HPKS batch: allocation failure accepted (ok=%v err=%v)", ok, err)
+	}
+}
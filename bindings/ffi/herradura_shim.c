@@ -7,29 +7,24 @@
  * be dlopen'd or linked against directly. This file gives each function a
  * fixed-width byte-buffer signature (32-byte KEYBYTES arrays) and external
  * linkage so it can cross an FFI boundary. Randomness is read from
- * /dev/urandom internally; callers never pass a FILE*.
+ * the OS CSPRNG internally; callers never pass a FILE*.
  *
  * Scope: the classical v1.4.0 quartet only (HKEX-GF/HSKE/HPKS/HPKE). NL/PQC
  * and Stern-F protocols are out of scope for TODO #137 — see TODO.md.
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include "../../herradura.h"
 #include "herradura_shim.h"
 
 #define HFFI_EXPORT __attribute__((visibility("default")))
 
+/* The header's buffered OS source: per-thread, fork-safe, no open FILE*. */
 static FILE *hffi_urandom(void)
 {
-    static __thread FILE *f = NULL;
-    if (!f) {
-        f = fopen("/dev/urandom", "rb");
-        if (!f) {
-            fputs("herradura_shim: could not open /dev/urandom\n", stderr);
-        }
-    }
-    return f;
+    return HERRADURA_OS_RNG;
 }
 
 /* HKEX-GF */
@@ -101,6 +96,31 @@ HFFI_EXPORT int hffi_hpks_verify(const uint8_t msg[KEYBYTES], const uint8_t pub[
     return hpks_verify(&msg_ba, &pub_ba, &R_ba, &s_ba);
 }
 
+/* Batch HPKS: msgs/pubs/Rs/ss are n contiguous KEYBYTES records.  Returns 1
+ * if every signature verifies, -1 if memory runs out; on 0, *bad_idx_out (if
+ * not NULL) receives the first failing index. */
+HFFI_EXPORT int hffi_hpks_verify_batch(const uint8_t *msgs, const uint8_t *pubs,
+                                        const uint8_t *Rs, const uint8_t *ss,
+                                        size_t n, size_t *bad_idx_out)
+{
+    BitArray *buf;
+    size_t i;
+    int ok;
+    if (n == 0) return 1;
+    buf = (BitArray *)malloc(4 * n * sizeof(BitArray));
+    if (!buf) return -1;
+    for (i = 0; i < n; i++) {
+        memcpy(buf[i].b,         msgs + i * KEYBYTES, KEYBYTES);
+        memcpy(buf[n + i].b,     pubs + i * KEYBYTES, KEYBYTES);
+        memcpy(buf[2 * n + i].b, Rs   + i * KEYBYTES, KEYBYTES);
+        memcpy(buf[3 * n + i].b, ss   + i * KEYBYTES, KEYBYTES);
+    }
+    ok = hpks_verify_batch(buf, buf + n, buf + 2 * n, buf + 3 * n, n,
+                           hffi_urandom(), bad_idx_out);
+    free(buf);
+    return ok;
+}
+
 /* HPKE (El Gamal) */
 
 HFFI_EXPORT int hffi_hpke_encrypt(const uint8_t pt[KEYBYTES], const uint8_t pub[KEYBYTES],
@@ -5,6 +5,7 @@
 #ifndef HERRADURA_SHIM_H
 #define HERRADURA_SHIM_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #define HFFI_KEYBYTES 32
@@ -27,6 +28,10 @@ void hffi_hpks_sign(const uint8_t msg[HFFI_KEYBYTES], const uint8_t priv[HFFI_KE
                      uint8_t R_out[HFFI_KEYBYTES], uint8_t s_out[HFFI_KEYBYTES]);
 int  hffi_hpks_verify(const uint8_t msg[HFFI_KEYBYTES], const uint8_t pub[HFFI_KEYBYTES],
                        const uint8_t R[HFFI_KEYBYTES], const uint8_t s[HFFI_KEYBYTES]);
+/* msgs/pubs/Rs/ss: n contiguous HFFI_KEYBYTES records each. */
+int  hffi_hpks_verify_batch(const uint8_t *msgs, const uint8_t *pubs,
+                             const uint8_t *Rs, const uint8_t *ss,
+                             size_t n, size_t *bad_idx_out);
 
 int hffi_hpke_encrypt(const uint8_t pt[HFFI_KEYBYTES], const uint8_t pub[HFFI_KEYBYTES],
                        uint8_t R_out[HFFI_KEYBYTES], uint8_t ct_out[HFFI_KEYBYTES]);
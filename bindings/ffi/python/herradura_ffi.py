@@ -74,6 +74,10 @@ class Herradura:
         lib.hffi_hpks_verify.argtypes = [_KeyBuf, _KeyBuf, _KeyBuf, _KeyBuf]
         lib.hffi_hpks_verify.restype = ctypes.c_int
 
+        lib.hffi_hpks_verify_batch.argtypes = [ctypes.c_char_p] * 4 + [
+            ctypes.c_size_t, ctypes.POINTER(ctypes.c_size_t)]
+        lib.hffi_hpks_verify_batch.restype = ctypes.c_int
+
         lib.hffi_hpke_encrypt.argtypes = [_KeyBuf, _KeyBuf, _KeyBuf, _KeyBuf]
         lib.hffi_hpke_encrypt.restype = ctypes.c_int
 
@@ -126,6 +130,22 @@ class Herradura:
         args = [self._buf(x) for x in (msg, pub, R, s)]
         return bool(self._lib.hffi_hpks_verify(*args))
 
+    def hpks_verify_batch(self, items):
+        """items: sequence of (msg, pub, R, s). Returns (True, None) if all
+        verify, else (False, index of the first bad signature)."""
+        cols = ([], [], [], [])
+        for item in items:
+            for col, x in zip(cols, item):
+                if len(x) != KEYBYTES:
+                    raise ValueError(f"expected {KEYBYTES} bytes, got {len(x)}")
+                col.append(bytes(x))
+        bad = ctypes.c_size_t(0)
+        ok = self._lib.hffi_hpks_verify_batch(
+            *[b"".join(col) for col in cols], len(cols[0]), ctypes.byref(bad))
+        if ok < 0:
+            raise MemoryError("hffi_hpks_verify_batch: out of memory")
+        return (True, None) if ok else (False, bad.value)
+
     # HPKE (El Gamal)
 
     def hpke_encrypt(self, pt, pub):
@@ -121,6 +121,16 @@ def main():
     ok_ffi_verify = h.hpks_verify(msg, a_pub_ffi, R_ffi, s_ffi)
     check("hpks_verify_self_consistent", b"1" if ok_ffi_verify else b"0", b"1")
 
+    batch = []
+    for _ in range(4):
+        m = h.random_bytes()
+        batch.append((m, a_pub_ffi) + h.hpks_sign(m, a_priv))
+    ok_batch, _ = h.hpks_verify_batch(batch)
+    check("hpks_verify_batch", b"1" if ok_batch else b"0", b"1")
+    batch[2] = (h.random_bytes(),) + batch[2][1:]
+    ok_batch, bad = h.hpks_verify_batch(batch)
+    check("hpks_verify_batch(bad)", b"%d" % (-1 if ok_batch else bad), b"2")
+
     # HPKE: use a native r fed through hffi's own encrypt path is impossible
     # (r is drawn internally by the FFI), so instead verify the *decrypt*
     # side against a native encryption with a known r.
@@ -120,6 +120,10 @@ public final class Hfscx256 {
     // -----------------------------------------------------------------
 
     private static final byte[] HKX_MAGIC = { 'H', 'K', 'X', '1' };
+    private static final byte[] HKX2_MAGIC = { 'H', 'K', 'X', '2' };
+    private static final byte[] HKX2_SEG_DS = "HKX2-SEG".getBytes(StandardCharsets.US_ASCII);
+    private static final int HKX2_HDR_LEN = 41;
+    private static final int HKX2_SEG_MAX = 1 << 24;
     private static final int HKX_ALGO_NLA1 = 0x01;
     private static final int HKX_BLOCK = 32;
 
@@ -177,6 +181,9 @@ public final class Hfscx256 {
     /** Decrypts a .hkx container produced by {@link #encFile}. Throws
      * IllegalArgumentException on any structural or authentication failure. */
     public static byte[] decFile(BigInteger key, byte[] raw) {
+        if (raw.length >= 4 && Arrays.equals(Arrays.copyOf(raw, 4), HKX2_MAGIC)) {
+            return decFileHkx2(key, raw);
+        }
         if (raw.length < 77) {
             throw new IllegalArgumentException("decfile: file too short to be a valid .hkx container");
         }
@@ -230,6 +237,73 @@ public final class Hfscx256 {
         return plaintext;
     }
 
+    /** Decrypts a segmented HKX2 container (as written by the C, Go and
+     * Python CLIs): header magic, algo byte, segment size S (be32), nonce,
+     * then segments ct_i || tag_i with
+     * tag_i = HFSCX-256-MAC(mac_key, "HKX2-SEG" || nonce || S || i_be8 || final || ct_i).
+     * Every segment is verified before any plaintext is returned. */
+    static byte[] decFileHkx2(BigInteger key, byte[] raw) {
+        if (raw.length < HKX2_HDR_LEN + 32) {
+            throw new IllegalArgumentException("decfile: file too short to be a valid .hkx container");
+        }
+        if ((raw[4] & 0xff) != HKX_ALGO_NLA1) {
+            throw new IllegalArgumentException(
+                String.format("decfile: unsupported algo byte 0x%02x", raw[4] & 0xff));
+        }
+        int seg = ((raw[5] & 0xff) << 24) | ((raw[6] & 0xff) << 16)
+                | ((raw[7] & 0xff) << 8) | (raw[8] & 0xff);
+        if (seg < HKX_BLOCK || seg > HKX2_SEG_MAX || seg % HKX_BLOCK != 0) {
+            throw new IllegalArgumentException("decfile: invalid HKX2 segment size");
+        }
+        byte[] nonceBytes = Arrays.copyOfRange(raw, 9, 9 + HKX_BLOCK);
+
+        BigInteger K = key.and(MASK);
+        BigInteger base = K.xor(new BigInteger(1, nonceBytes)).and(MASK);
+        BigInteger seed = Herradura.rol(base, N / 8).xor(RNL_KDF_DC_256).and(MASK);
+        int steps = N / 4;
+        BigInteger macKey = nlFscxRevolveV1(Herradura.rol(seed, N / 4), base, steps);
+        BigInteger macIv = macKey.xor(IV_CONST).and(MASK);
+
+        int rec = seg + 32;
+        int body = raw.length - HKX2_HDR_LEN;
+        int nSegs = (body + rec - 1) / rec;
+        int last = body - (nSegs - 1) * rec;
+        if (last < 32) {
+            throw new IllegalArgumentException("decfile: file truncated (segment or auth tag missing)");
+        }
+        byte[] plaintext = new byte[body - 32 * nSegs];
+        int pre = HKX2_SEG_DS.length + HKX_BLOCK + 4;
+        for (int i = 0; i < nSegs; i++) {
+            int off = HKX2_HDR_LEN + i * rec;
+            int ctLen = (i == nSegs - 1) ? last - 32 : seg;
+            byte[] macData = new byte[pre + 9 + ctLen];
+            System.arraycopy(HKX2_SEG_DS, 0, macData, 0, HKX2_SEG_DS.length);
+            System.arraycopy(nonceBytes, 0, macData, HKX2_SEG_DS.length, HKX_BLOCK);
+            System.arraycopy(raw, 5, macData, HKX2_SEG_DS.length + HKX_BLOCK, 4);
+            writeBe64(macData, pre, i);
+            macData[pre + 8] = (byte) ((i == nSegs - 1) ? 1 : 0);
+            System.arraycopy(raw, off, macData, pre + 9, ctLen);
+            byte[] tagStored = Arrays.copyOfRange(raw, off + ctLen, off + ctLen + 32);
+            if (!constantTimeEquals(tagStored, hash(macData, macIv))) {
+                throw new IllegalArgumentException("decfile: authentication tag mismatch — file corrupt or wrong key");
+            }
+        }
+        for (int i = 0; i < nSegs; i++) {
+            int off = HKX2_HDR_LEN + i * rec;
+            int ctLen = (i == nSegs - 1) ? last - 32 : seg;
+            for (int b = 0; b < ctLen; b += HKX_BLOCK) {
+                long ctr = ((long) i * seg + b) / HKX_BLOCK;
+                BigInteger ks = nlFscxRevolveV1(seed, base.xor(BigInteger.valueOf(ctr)).and(MASK), steps);
+                byte[] ksBytes = toFixedBytes(ks, HKX_BLOCK);
+                int len = Math.min(HKX_BLOCK, ctLen - b);
+                for (int j = 0; j < len; j++) {
+                    plaintext[i * seg + b + j] = (byte) (raw[off + b + j] ^ ksBytes[j]);
+                }
+            }
+        }
+        return plaintext;
+    }
+
     private static void writeBe64(byte[] buf, int off, long v) {
         for (int i = 0; i < 8; i++) {
             buf[off + i] = (byte) (v >>> (8 * (7 - i)));
@@ -10,8 +10,9 @@ import java.security.SecureRandom;
  * quartet ({@link Herradura}), the NL/PQC quartet ({@link HerraduraNl}),
  * HPKS-Stern-F/HPKE-Stern-F/HPKE-Stern-KEM ({@link Stern}), the OPRF
  * ({@link Oprf}), HPKS-WOTS-F/HPKS-XMSS-F ({@link Wots}, {@link Xmss}),
- * HCRED ({@link Hcred}), and aPAKE ({@link ZkpNl}, {@link Hpake}). Exits
- * non-zero on any failure.
+ * HCRED ({@link Hcred}), and aPAKE ({@link ZkpNl}, {@link Hpake}), plus a
+ * fixed HKX2 container for the segmented file reader ({@link Hfscx256}).
+ * Exits non-zero on any failure.
  *
  * Usage: java -cp bindings/java herradurakex.SelfTest
  */
@@ -380,10 +381,67 @@ public final class SelfTest {
             }
         }
 
+        // HKX2 decfile: a fixed three-segment container (64-byte segments,
+        // 150-byte plaintext) written by the Python CLI and checked against
+        // the C and Go readers. Tampering, dropping the final segment, and
+        // swapping two segments must all be rejected.
+        {
+            BigInteger key = new BigInteger(
+                "4148add605089a7cbf028b5f832ca49622cdb3a7add7c5bc068ddc66ec84793a", 16);
+            byte[] hkx = unhex(
+              "484b58320100000040404142434445464748494a4b4c4d4e4f50515253545556"
+            + "5758595a5b5c5d5e5f50642b28a8678cb86b473eac4be2b03857db6f1de5be42"
+            + "4b5d8f36306bd4779ee087cab7afaff93cadbc4c54c5d245fd1b6ae0109d22db"
+            + "1c11db9d454c27964ab1f0413c0f1255e376aed1fc46611df2f11b0d63e3234d"
+            + "8c262b9317c992ef766a34805b0406659f6b397efd6be176da8f9454c909a6bc"
+            + "ffdfdfc49255a24e8482548adb4412e070c568a50aee0b7e4e478d0194798b94"
+            + "d31a1d2a1d226055df2e188d33978690b5eab16962e328b12ed93675f460fcdc"
+            + "bd6402ace5a9739643e23551ff34b47d0aef9f65aebb3714f2a35c8b37740a0e"
+            + "2118160945c2bc12af901841a5ecf76eecad6d69a95f9ff66e68ca7b770bc3");
+            byte[] pt = new byte[150];
+            for (int i = 0; i < pt.length; i++) {
+                pt[i] = (byte) (i * 7 + 3);
+            }
+            boolean ok = java.util.Arrays.equals(Hfscx256.decFile(key, hkx), pt);
+            byte[] flipped = hkx.clone();
+            flipped[hkx.length - 40] ^= 1;
+            byte[] truncated = java.util.Arrays.copyOf(hkx, 41 + 2 * 96);
+            byte[] swapped = hkx.clone();
+            System.arraycopy(hkx, 41 + 96, swapped, 41, 96);
+            System.arraycopy(hkx, 41, swapped, 41 + 96, 96);
+            boolean rejectsTamper = hkx2Rejects(key, flipped);
+            boolean rejectsTruncation = hkx2Rejects(key, truncated);
+            boolean rejectsReorder = hkx2Rejects(key, swapped);
+            if (!ok || !rejectsTamper || !rejectsTruncation || !rejectsReorder) {
+                System.out.println("FAIL hkx2 decfile (decrypt=" + ok + " rejects_tamper=" + rejectsTamper
+                    + " rejects_truncation=" + rejectsTruncation + " rejects_reorder=" + rejectsReorder + ")");
+                fails++;
+            } else {
+                System.out.println("PASS hkx2 decfile");
+            }
+        }
+
         if (fails > 0) {
             System.out.println(fails + " test(s) FAILED");
             System.exit(1);
         }
         System.out.println("All round-trip self-tests passed.");
     }
+
+    private static boolean hkx2Rejects(BigInteger key, byte[] raw) {
+        try {
+            Hfscx256.decFile(key, raw);
+            return false;
+        } catch (IllegalArgumentException e) {
+            return true;
+        }
+    }
+
+    private static byte[] unhex(String s) {
+        byte[] out = new byte[s.length() / 2];
+        for (int i = 0; i < out.length; i++) {
+            out[i] = (byte) Integer.parseInt(s.substring(2 * i, 2 * i + 2), 16);
+        }
+        return out;
+    }
 }
@@ -38,11 +38,46 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
+#if defined(__unix__) || defined(__APPLE__)
+#  include <unistd.h>      /* defines _POSIX_THREADS where pthreads exist */
+#endif
 #ifdef _POSIX_THREADS
 #  include <pthread.h>
 #else
 #  include <stdatomic.h>
 #endif
+/* OS entropy for HERRADURA_OS_RNG (see "Entropy source" below). */
+#if defined(__linux__) && defined(__has_include)
+#  if __has_include(<sys/random.h>)
+#    include <sys/random.h>
+#    include <errno.h>
+#    define HERRADURA_HAVE_GETRANDOM 1
+#  endif
+#elif defined(__APPLE__) || defined(__OpenBSD__) || defined(__FreeBSD__)
+#  include <sys/random.h>
+#  define HERRADURA_HAVE_GETENTROPY 1
+#endif
+/* x86-64 carry-less multiply for gf_mul_ba.  Compiled via target attributes and
+   selected at run time, so no -m flags are needed; define HERRADURA_NO_CLMUL to
+   build the portable path only. */
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) \
+    && !defined(HERRADURA_NO_CLMUL)
+#  define HERRADURA_HAVE_PCLMUL 1
+#  include <wmmintrin.h>
+#endif
+/* x86-64 add/subtract-with-carry intrinsics for the 64-bit limb arithmetic.
+   ADC/SBB are base ISA, so no target attributes are involved. */
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#  define HERRADURA_HAVE_ADDCARRY 1
+#  include <immintrin.h>
+#endif
+/* x86-64 AVX2 lanes for the multi-buffer HFSCX-256 engine.  Same scheme as
+   PCLMUL: target attributes plus run-time selection; define HERRADURA_NO_AVX2
+   to build the portable path only. */
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) \
+    && !defined(HERRADURA_NO_AVX2)
+#  define HERRADURA_HAVE_AVX2 1
+#endif
 
 /* ─────────────────────────────────────────────────────────────────────────────
  * Key-size parameters
@@ -66,6 +101,97 @@ typedef struct {
     uint8_t b[KEYBYTES];
 } BitArray;
 
+/* ─────────────────────────────────────────────────────────────────────────────
+ * Entropy source
+ *
+ * Every randomised routine takes a FILE *urnd.  Passing an open stream (the
+ * historical fopen("/dev/urandom")) reads from it with fread as before; passing
+ * HERRADURA_OS_RNG (NULL) draws from a per-thread HRAND_BUF_BYTES buffer that
+ * is refilled from the OS CSPRNG (getrandom / getentropy, /dev/urandom as a
+ * last resort) one syscall at a time, so the many 1-3 byte rejection-sampling
+ * reads in keygen and signing cost a memcpy instead of a locked stdio call.
+ * Consumed bytes are wiped from the buffer; the buffer is discarded in the
+ * child after fork() so parent and child never share output.
+ * ───────────────────────────────────────────────────────────────────────────── */
+
+#define HERRADURA_OS_RNG ((FILE *)0)
+#define HRAND_BUF_BYTES  4096
+
+typedef struct {
+    uint8_t buf[HRAND_BUF_BYTES];
+    size_t  pos;                      /* next unread byte; HRAND_BUF_BYTES = empty */
+} _HRandBuf;
+
+static _Thread_local _HRandBuf _hrand_tls = { {0}, HRAND_BUF_BYTES };
+
+/* Fill p with n bytes from the OS CSPRNG.  Returns 1 on success. */
+static int _hrand_os_fill(uint8_t *p, size_t n)
+{
+#if defined(HERRADURA_HAVE_GETRANDOM)
+    while (n > 0) {
+        ssize_t r = getrandom(p, n, 0);
+        if (r < 0) { if (errno == EINTR) continue; return 0; }
+        p += r; n -= (size_t)r;
+    }
+    return 1;
+#elif defined(HERRADURA_HAVE_GETENTROPY)
+    while (n > 0) {
+        size_t c = n < 256 ? n : 256;   /* getentropy caps requests at 256 */
+        if (getentropy(p, c) != 0) return 0;
+        p += c; n -= c;
+    }
+    return 1;
+#else
+    FILE *f = fopen("/dev/urandom", "rb");
+    size_t got;
+    if (!f) return 0;
+    got = fread(p, 1, n, f);
+    fclose(f);
+    return got == n;
+#endif
+}
+
+#ifdef _POSIX_THREADS
+static void _hrand_atfork_child(void)
+{
+    explicit_bzero(_hrand_tls.buf, sizeof _hrand_tls.buf);
+    _hrand_tls.pos = HRAND_BUF_BYTES;
+}
+static pthread_once_t hrand_fork_once = PTHREAD_ONCE_INIT;
+static void hrand_fork_do_init(void) { pthread_atfork(NULL, NULL, _hrand_atfork_child); }
+static void hrand_fork_init(void) { pthread_once(&hrand_fork_once, hrand_fork_do_init); }
+#else
+static void hrand_fork_init(void) { }
+#endif
+
+/* Read exactly n random bytes into buf.  urnd is either an open stream or
+   HERRADURA_OS_RNG.  Returns 1 on success, 0 on a short read or OS error. */
+static int urnd_read(FILE *urnd, void *buf, size_t n)
+{
+    _HRandBuf *rb = &_hrand_tls;
+    uint8_t *out = (uint8_t *)buf;
+
+    if (urnd) return fread(buf, 1, n, urnd) == n;
+
+    /* Large requests skip the buffer: one syscall, no extra copy. */
+    if (n >= HRAND_BUF_BYTES) return _hrand_os_fill(out, n);
+
+    while (n > 0) {
+        size_t avail, c;
+        if (rb->pos == HRAND_BUF_BYTES) {
+            hrand_fork_init();
+            if (!_hrand_os_fill(rb->buf, HRAND_BUF_BYTES)) return 0;
+            rb->pos = 0;
+        }
+        avail = HRAND_BUF_BYTES - rb->pos;
+        c = n < avail ? n : avail;
+        memcpy(out, rb->buf + rb->pos, c);
+        explicit_bzero(rb->buf + rb->pos, c);
+        rb->pos += c; out += c; n -= c;
+    }
+    return 1;
+}
+
 /* ─────────────────────────────────────────────────────────────────────────────
  * BitArray primitives
  * ───────────────────────────────────────────────────────────────────────────── */
@@ -73,7 +199,7 @@ typedef struct {
 /* Fill dst with KEYBYTES random bytes from urnd (/dev/urandom). */
 static void ba_rand(BitArray *dst, FILE *urnd)
 {
-    if (fread(dst->b, 1, KEYBYTES, urnd) != (size_t)KEYBYTES) {
+    if (!urnd_read(urnd, dst->b, KEYBYTES)) {
         fputs("ERROR: could not read from /dev/urandom\n", stderr);
         exit(1);
     }
@@ -140,50 +266,355 @@ static int ba_popcount(const BitArray *a)
  * FSCX primitives
  * ───────────────────────────────────────────────────────────────────────────── */
 
+/* Word-sliced working form of a BitArray: four 64-bit limbs, w[0] most
+   significant (same order as BitArray.b).  The FSCX family converts at the
+   API boundary and runs its inner loops on limbs, so a 256-bit rotate-by-1
+   is four shift pairs instead of a 32-byte carry walk. */
+typedef struct {
+    uint64_t w[4];
+} BaWords;
+
+/* Big-endian 64-bit load/store, written so compilers fold each into a single
+   byte-swapped access. */
+static inline uint64_t baw_be64(const uint8_t *p)
+{
+    return ((uint64_t)p[0] << 56) | ((uint64_t)p[1] << 48) | ((uint64_t)p[2] << 40)
+         | ((uint64_t)p[3] << 32) | ((uint64_t)p[4] << 24) | ((uint64_t)p[5] << 16)
+         | ((uint64_t)p[6] << 8)  |  (uint64_t)p[7];
+}
+
+static inline void baw_put_be64(uint8_t *p, uint64_t v)
+{
+    p[0] = (uint8_t)(v >> 56); p[1] = (uint8_t)(v >> 48);
+    p[2] = (uint8_t)(v >> 40); p[3] = (uint8_t)(v >> 32);
+    p[4] = (uint8_t)(v >> 24); p[5] = (uint8_t)(v >> 16);
+    p[6] = (uint8_t)(v >> 8);  p[7] = (uint8_t)v;
+}
+
+static inline void baw_load(BaWords *dst, const BitArray *src)
+{
+    int i;
+    for (i = 0; i < 4; i++) dst->w[i] = baw_be64(src->b + 8 * i);
+}
+
+static inline void baw_store(BitArray *dst, const BaWords *src)
+{
+    int i;
+    for (i = 0; i < 4; i++) baw_put_be64(dst->b + 8 * i, src->w[i]);
+}
+
+/* fscx on limbs.  ROL/ROR are GF(2)-linear, so the six-term XOR collapses to
+   x ^ ROL(x) ^ ROR(x) with x = a ^ b.  Aliasing r == a or r == b is safe. */
+static inline void baw_fscx(BaWords *r, const BaWords *a, const BaWords *b)
+{
+    uint64_t x0 = a->w[0] ^ b->w[0], x1 = a->w[1] ^ b->w[1];
+    uint64_t x2 = a->w[2] ^ b->w[2], x3 = a->w[3] ^ b->w[3];
+    r->w[0] = x0 ^ ((x0 << 1) | (x1 >> 63)) ^ ((x0 >> 1) | (x3 << 63));
+    r->w[1] = x1 ^ ((x1 << 1) | (x2 >> 63)) ^ ((x1 >> 1) | (x0 << 63));
+    r->w[2] = x2 ^ ((x2 << 1) | (x3 >> 63)) ^ ((x2 >> 1) | (x1 << 63));
+    r->w[3] = x3 ^ ((x3 << 1) | (x0 >> 63)) ^ ((x3 >> 1) | (x2 << 63));
+}
+
+/* 64-bit add with carry: returns a + b + *c, carry out to *c (0 or 1). */
+static inline uint64_t baw_adc64(uint64_t a, uint64_t b, unsigned char *c)
+{
+#ifdef HERRADURA_HAVE_ADDCARRY
+    unsigned long long r;
+    *c = _addcarry_u64(*c, a, b, &r);
+    return (uint64_t)r;
+#else
+    uint64_t s = a + *c;
+    unsigned char c1 = s < *c;
+    s += b;
+    *c = c1 | (s < b);
+    return s;
+#endif
+}
+
+/* 64-bit subtract with borrow: returns a − b − *c, borrow out to *c. */
+static inline uint64_t baw_sbb64(uint64_t a, uint64_t b, unsigned char *c)
+{
+#ifdef HERRADURA_HAVE_ADDCARRY
+    unsigned long long r;
+    *c = _subborrow_u64(*c, a, b, &r);
+    return (uint64_t)r;
+#else
+    uint64_t d = a - b, r = d - *c;
+    *c = (unsigned char)((a < b) | (d < *c));
+    return r;
+#endif
+}
+
+/* Multiply-accumulate: returns the low word of a·b + t + *c, high word to *c.
+   The sum cannot overflow 128 bits. */
+static inline uint64_t baw_mac64(uint64_t t, uint64_t a, uint64_t b, uint64_t *c)
+{
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 p = (unsigned __int128)a * b + t + *c;
+    *c = (uint64_t)(p >> 64);
+    return (uint64_t)p;
+#else
+    uint64_t a0 = (uint32_t)a, a1 = a >> 32, b0 = (uint32_t)b, b1 = b >> 32;
+    uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+    uint64_t mid = (p00 >> 32) + (uint32_t)p01 + (uint32_t)p10;
+    uint64_t lo = (mid << 32) | (uint32_t)p00;
+    uint64_t hi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+    lo += t;  hi += lo < t;
+    lo += *c; hi += lo < *c;
+    *c = hi;
+    return lo;
+#endif
+}
+
+/* r = (a + b) mod 2^256 on limbs.  Branch-free carry chain. */
+static inline void baw_add(BaWords *r, const BaWords *a, const BaWords *b)
+{
+    unsigned char c = 0;
+    int i;
+    for (i = 3; i >= 0; i--)
+        r->w[i] = baw_adc64(a->w[i], b->w[i], &c);
+}
+
+/* r = (a − b) mod 2^256 on limbs. */
+static inline void baw_sub(BaWords *r, const BaWords *a, const BaWords *b)
+{
+    unsigned char c = 0;
+    int i;
+    for (i = 3; i >= 0; i--)
+        r->w[i] = baw_sbb64(a->w[i], b->w[i], &c);
+}
+
+/* r = a·b mod 2^256: the ten limb products of the low half.  Aliasing safe. */
+static inline void baw_mul_lo(BaWords *r, const BaWords *a, const BaWords *b)
+{
+    uint64_t t[4] = {0}, c;
+    int i, j;
+    for (i = 0; i < 4; i++) {               /* t[k] = limb k, least significant first */
+        c = 0;
+        for (j = 0; j < 4 - i; j++)
+            t[i + j] = baw_mac64(t[i + j], a->w[3 - i], b->w[3 - j], &c);
+    }
+    for (i = 0; i < 4; i++) r->w[3 - i] = t[i];
+}
+
 /* Full Surroundings Cyclic XOR:
    result = a XOR b XOR ROL(a) XOR ROL(b) XOR ROR(a) XOR ROR(b)
-   Fused single-pass; requires KEYBYTES >= 2. */
+   Word-sliced; see baw_fscx. */
 static void ba_fscx(BitArray *result, const BitArray *a, const BitArray *b)
 {
-    uint8_t a_msbit = a->b[0] >> 7;
-    uint8_t b_msbit = b->b[0] >> 7;
-    uint8_t a_lsbit = a->b[KEYBYTES - 1] & 1;
-    uint8_t b_lsbit = b->b[KEYBYTES - 1] & 1;
+    BaWords wa, wb;
+    baw_load(&wa, a);
+    baw_load(&wb, b);
+    baw_fscx(&wa, &wa, &wb);
+    baw_store(result, &wa);
+}
+
+/* FSCX_REVOLVE, iterative engine: iterate fscx(a, b) steps times keeping b
+   constant.  The loop state stays in limbs; bytes are touched only on entry
+   and exit. */
+static void ba_fscx_revolve_iter(BitArray *result, const BitArray *a,
+                                  const BitArray *b, int steps)
+{
+    BaWords wa, wb;
     int i;
+    baw_load(&wa, a);
+    baw_load(&wb, b);
+    for (i = 0; i < steps; i++)
+        baw_fscx(&wa, &wa, &wb);
+    baw_store(result, &wa);
+}
+
+/* ─────────────────────────────────────────────────────────────────────────────
+ * Closed-form FSCX_REVOLVE (TODO #213)
+ *
+ * Rotation by one bit is multiplication by x in R = GF(2)[x]/(x^256 + 1), so
+ * fscx(a, b) = m·(a ⊕ b) with m(x) = 1 + x + x^255, and
+ *
+ *     fscx_revolve(A, B, i) = m^i·A ⊕ T_i·B,   T_i = m + m^2 + ... + m^i.
+ *
+ * m^i and T_i depend only on i; they are built by square-and-multiply
+ * (T_2k = T_k ⊕ m^k·T_k, T_k+1 = m·(T_k ⊕ 1)) in O(log i) ring products.
+ * Because m^128 = 1 (Frobenius: m^128 = 1 + x^128 + x^-128), m^64 = m^192 =
+ * 1 + x^64 + x^192 and both HSKE directions cost the same three rotations once
+ * T_i·B is cached per key (FscxRevolveKey).  Output is byte-identical to the
+ * iterative engine; KAT/classical_quartet.json's HSKE vector is the oracle.
+ *
+ * Ring products here always have one public operand (m^i, T_i), so the loop
+ * over its set bits is variable-time in public data only; the secret operand
+ * only ever feeds fixed-distance rotations and XORs.
+ * ───────────────────────────────────────────────────────────────────────────── */
+
+#define FSCX_REVOLVE_ITERATIVE   0
+#define FSCX_REVOLVE_CLOSED_FORM 1
 
-    result->b[0] = a->b[0] ^ b->b[0]
-        ^ (uint8_t)((a->b[0] << 1) | (a->b[1] >> 7))
-        ^ (uint8_t)((b->b[0] << 1) | (b->b[1] >> 7))
-        ^ (uint8_t)((a->b[0] >> 1) | (a_lsbit << 7))
-        ^ (uint8_t)((b->b[0] >> 1) | (b_lsbit << 7));
+static int fscx_revolve_engine = FSCX_REVOLVE_ITERATIVE;
+
+/* Select the engine ba_fscx_revolve dispatches to.  Returns the previous one.
+   Both engines produce identical output; the choice is purely a speed trade:
+   the closed form wins for large step counts (HSKE decrypt, 192 steps) and for
+   repeated use of one key via FscxRevolveKey. */
+static inline int fscx_revolve_set_engine(int engine)
+{
+    int prev = fscx_revolve_engine;
+    fscx_revolve_engine = engine ? FSCX_REVOLVE_CLOSED_FORM : FSCX_REVOLVE_ITERATIVE;
+    return prev;
+}
+
+/* r = ROL(a, k) — multiplication by x^k in R.  0 <= k < 256; k is public. */
+static inline void baw_rol(BaWords *r, const BaWords *a, int k)
+{
+    int q = k >> 6, s = k & 63, i;
+    uint64_t le[4], out[4];
+    for (i = 0; i < 4; i++) le[i] = a->w[3 - i];   /* le[0] = least significant */
+    for (i = 0; i < 4; i++) {
+        out[i] = le[(i - q) & 3] << s;
+        if (s) out[i] |= le[(i - q - 1) & 3] >> (64 - s);
+    }
+    for (i = 0; i < 4; i++) r->w[3 - i] = out[i];
+}
+
+/* r = p·a in R, p public.  Aliasing r == a or r == p is safe. */
+static void baw_cmul_pub(BaWords *r, const BaWords *p, const BaWords *a)
+{
+    BaWords acc, rot;
+    int li;
+    memset(&acc, 0, sizeof(acc));
+    for (li = 0; li < 4; li++) {
+        uint64_t v = p->w[3 - li];
+        while (v) {                         /* walk set bits of the public operand */
+            baw_rol(&rot, a, 64 * li + __builtin_ctzll(v));
+            acc.w[0] ^= rot.w[0]; acc.w[1] ^= rot.w[1];
+            acc.w[2] ^= rot.w[2]; acc.w[3] ^= rot.w[3];
+            v &= v - 1;
+        }
+    }
+    *r = acc;
+}
+
+/* m^steps and T_steps for one step count. */
+typedef struct {
+    BaWords mi;
+    BaWords ti;
+} FscxRevolvePlan;
+
+static void fscx_revolve_plan_build(FscxRevolvePlan *plan, int steps)
+{
+    static const BaWords m = {{ UINT64_C(0x8000000000000000), 0, 0, 3 }};
+    BaWords p, t, u;
+    int bit;
+    memset(&p, 0, sizeof(p)); p.w[3] = 1;   /* m^0 = 1 */
+    memset(&t, 0, sizeof(t));               /* T_0 = 0 */
+    if (steps < 0) steps = 0;
+    for (bit = 30; bit >= 0; bit--) {
+        baw_cmul_pub(&u, &p, &t);           /* T_2k = T_k ⊕ m^k·T_k */
+        t.w[0] ^= u.w[0]; t.w[1] ^= u.w[1]; t.w[2] ^= u.w[2]; t.w[3] ^= u.w[3];
+        baw_cmul_pub(&p, &p, &p);
+        if ((steps >> bit) & 1) {
+            t.w[3] ^= 1;                    /* T_k+1 = m·(T_k ⊕ 1) */
+            baw_cmul_pub(&t, &m, &t);
+            baw_cmul_pub(&p, &m, &p);
+        }
+    }
+    plan->mi = p;
+    plan->ti = t;
+}
+
+/* Plans for the two step counts every classical protocol uses. */
+static FscxRevolvePlan fscx_plan_i, fscx_plan_r;
+
+static void fscx_revolve_plans_do_init(void)
+{
+    fscx_revolve_plan_build(&fscx_plan_i, I_VALUE);
+    fscx_revolve_plan_build(&fscx_plan_r, R_VALUE);
+}
+
+#ifdef _POSIX_THREADS
+static pthread_once_t fscx_plan_once = PTHREAD_ONCE_INIT;
+static void fscx_revolve_plans_init(void) { pthread_once(&fscx_plan_once, fscx_revolve_plans_do_init); }
+#else
+/* 0 = uninitialized, 1 = in progress, 2 = done */
+static _Atomic int fscx_plan_state = 0;
+static void fscx_revolve_plans_init(void)
+{
+    int expected = 0;
+    if (atomic_load_explicit(&fscx_plan_state, memory_order_acquire) == 2) return;
+    if (atomic_compare_exchange_strong_explicit(
+            &fscx_plan_state, &expected, 1,
+            memory_order_acq_rel, memory_order_acquire)) {
+        fscx_revolve_plans_do_init();
+        atomic_store_explicit(&fscx_plan_state, 2, memory_order_release);
+    } else {
+        while (atomic_load_explicit(&fscx_plan_state, memory_order_acquire) != 2) {}
+    }
+}
+#endif
 
-    for (i = 1; i < KEYBYTES - 1; i++)
-        result->b[i] = a->b[i] ^ b->b[i]
-            ^ (uint8_t)((a->b[i] << 1) | (a->b[i + 1] >> 7))
-            ^ (uint8_t)((b->b[i] << 1) | (b->b[i + 1] >> 7))
-            ^ (uint8_t)((a->b[i] >> 1) | (a->b[i - 1] << 7))
-            ^ (uint8_t)((b->b[i] >> 1) | (b->b[i - 1] << 7));
+/* Cached plan for I_VALUE / R_VALUE; other step counts are built into *tmp. */
+static const FscxRevolvePlan *fscx_revolve_plan_get(int steps, FscxRevolvePlan *tmp)
+{
+    if (steps == I_VALUE || steps == R_VALUE) {
+        fscx_revolve_plans_init();
+        return steps == I_VALUE ? &fscx_plan_i : &fscx_plan_r;
+    }
+    fscx_revolve_plan_build(tmp, steps);
+    return tmp;
+}
 
-    result->b[KEYBYTES - 1] = a->b[KEYBYTES-1] ^ b->b[KEYBYTES-1]
-        ^ (uint8_t)((a->b[KEYBYTES-1] << 1) | a_msbit)
-        ^ (uint8_t)((b->b[KEYBYTES-1] << 1) | b_msbit)
-        ^ (uint8_t)((a->b[KEYBYTES-1] >> 1) | (a->b[KEYBYTES-2] << 7))
-        ^ (uint8_t)((b->b[KEYBYTES-1] >> 1) | (b->b[KEYBYTES-2] << 7));
+/* FSCX_REVOLVE, closed-form engine: m^steps·a ⊕ T_steps·b. */
+static void ba_fscx_revolve_closed(BitArray *result, const BitArray *a,
+                                    const BitArray *b, int steps)
+{
+    FscxRevolvePlan tmp;
+    const FscxRevolvePlan *pl = fscx_revolve_plan_get(steps, &tmp);
+    BaWords wa, wb;
+    baw_load(&wa, a);
+    baw_load(&wb, b);
+    baw_cmul_pub(&wa, &pl->mi, &wa);
+    baw_cmul_pub(&wb, &pl->ti, &wb);
+    wa.w[0] ^= wb.w[0]; wa.w[1] ^= wb.w[1]; wa.w[2] ^= wb.w[2]; wa.w[3] ^= wb.w[3];
+    baw_store(result, &wa);
 }
 
-/* FSCX_REVOLVE: iterate fscx(a, b) steps times keeping b constant.
-   Double-buffered to avoid copying the result back every step. */
+/* FSCX_REVOLVE: fscx(a, b) iterated steps times with b constant, evaluated by
+   whichever engine fscx_revolve_set_engine selected. */
 static void ba_fscx_revolve(BitArray *result, const BitArray *a,
                              const BitArray *b, int steps)
 {
-    BitArray buf[2];
-    int idx = 0, i;
-    buf[0] = *a;
-    for (i = 0; i < steps; i++) {
-        ba_fscx(&buf[1 - idx], &buf[idx], b);
-        idx ^= 1;
-    }
-    *result = buf[idx];
+    if (fscx_revolve_engine == FSCX_REVOLVE_CLOSED_FORM)
+        ba_fscx_revolve_closed(result, a, b, steps);
+    else
+        ba_fscx_revolve_iter(result, a, b, steps);
+}
+
+/* Per-key closed form: caches T_steps·B so each call costs one m^steps·A
+   product (three rotations at steps = 64 or 192).  mi is public but tb alone
+   reproduces fscx_revolve(., B, steps), so it is as secret as B: callers
+   explicit_bzero the struct (or the HskeKey holding it) when B is retired. */
+typedef struct {
+    BaWords mi;
+    BaWords tb;
+} FscxRevolveKey;
+
+static inline void fscx_revolve_key_init(FscxRevolveKey *k, const BitArray *b, int steps)
+{
+    FscxRevolvePlan tmp;
+    const FscxRevolvePlan *pl = fscx_revolve_plan_get(steps, &tmp);
+    BaWords wb;
+    baw_load(&wb, b);
+    k->mi = pl->mi;
+    baw_cmul_pub(&k->tb, &pl->ti, &wb);
+}
+
+/* result = fscx_revolve(a, B, steps) for the (B, steps) bound into k. */
+static inline void fscx_revolve_key_apply(BitArray *result, const BitArray *a,
+                                    const FscxRevolveKey *k)
+{
+    BaWords wa;
+    baw_load(&wa, a);
+    baw_cmul_pub(&wa, &k->mi, &wa);
+    wa.w[0] ^= k->tb.w[0]; wa.w[1] ^= k->tb.w[1];
+    wa.w[2] ^= k->tb.w[2]; wa.w[3] ^= k->tb.w[3];
+    baw_store(result, &wa);
 }
 
 /* ─────────────────────────────────────────────────────────────────────────────
@@ -237,12 +668,13 @@ static int ba_shr1(BitArray *a)
     return carry;
 }
 
-/* GF(2^KEYBITS) multiplication: dst = a * b mod GF_POLY.
-   Shift-and-XOR: O(KEYBITS) iterations. */
+/* Reference GF(2^KEYBITS) multiplication: dst = a * b mod GF_POLY.
+   Shift-and-XOR: O(KEYBITS) iterations.  Kept as the oracle the tests check
+   gf_mul_ba's carry-less backends against. */
 /* SA-02/03: constant-time GF(2^KEYBITS) multiply.
    All branches replaced with bitmask selects so execution time is
    independent of the value of either operand (private key). */
-static void gf_mul_ba(BitArray *dst, const BitArray *a, const BitArray *b)
+static inline void gf_mul_ba_ref(BitArray *dst, const BitArray *a, const BitArray *b)
 {
     BitArray r, aa, bb;
     uint8_t bit_mask, carry_mask;
@@ -265,6 +697,215 @@ static void gf_mul_ba(BitArray *dst, const BitArray *a, const BitArray *b)
     *dst = r;
 }
 
+/* ── Carry-less 256x256 -> 512-bit products ────────────────────────────────
+   Operands and results are little-endian limb arrays (x[0] holds x^0..x^63).
+   Both backends are constant-time: the portable one uses integer multiplies
+   with 3-bit holes (no data-dependent branches or table lookups), PCLMULQDQ is
+   constant-time by construction. */
+
+/* 32x32 -> 64 carry-less multiply.  Each operand is split into four
+   interleaved masks so every integer partial product accumulates at most
+   8 bits per 4-bit slot; the carries never reach the next slot. */
+static inline uint64_t gf_bmul32(uint32_t x, uint32_t y)
+{
+    uint64_t x0 = x & 0x11111111u, x1 = x & 0x22222222u;
+    uint64_t x2 = x & 0x44444444u, x3 = x & 0x88888888u;
+    uint64_t y0 = y & 0x11111111u, y1 = y & 0x22222222u;
+    uint64_t y2 = y & 0x44444444u, y3 = y & 0x88888888u;
+    uint64_t z0 = (x0 * y0) ^ (x1 * y3) ^ (x2 * y2) ^ (x3 * y1);
+    uint64_t z1 = (x0 * y1) ^ (x1 * y0) ^ (x2 * y3) ^ (x3 * y2);
+    uint64_t z2 = (x0 * y2) ^ (x1 * y1) ^ (x2 * y0) ^ (x3 * y3);
+    uint64_t z3 = (x0 * y3) ^ (x1 * y2) ^ (x2 * y1) ^ (x3 * y0);
+    return (z0 & UINT64_C(0x1111111111111111)) | (z1 & UINT64_C(0x2222222222222222))
+         | (z2 & UINT64_C(0x4444444444444444)) | (z3 & UINT64_C(0x8888888888888888));
+}
+
+/* 64x64 -> 128 (Karatsuba over gf_bmul32). */
+static inline void gf_clmul64(uint64_t r[2], uint64_t a, uint64_t b)
+{
+    uint64_t lo  = gf_bmul32((uint32_t)a, (uint32_t)b);
+    uint64_t hi  = gf_bmul32((uint32_t)(a >> 32), (uint32_t)(b >> 32));
+    uint64_t mid = gf_bmul32((uint32_t)(a ^ (a >> 32)), (uint32_t)(b ^ (b >> 32)))
+                 ^ lo ^ hi;
+    r[0] = lo ^ (mid << 32);
+    r[1] = hi ^ (mid >> 32);
+}
+
+/* 128x128 -> 256 (Karatsuba over gf_clmul64). */
+static inline void gf_clmul128(uint64_t r[4], const uint64_t a[2], const uint64_t b[2])
+{
+    uint64_t lo[2], hi[2], mid[2];
+    gf_clmul64(lo,  a[0], b[0]);
+    gf_clmul64(hi,  a[1], b[1]);
+    gf_clmul64(mid, a[0] ^ a[1], b[0] ^ b[1]);
+    mid[0] ^= lo[0] ^ hi[0];
+    mid[1] ^= lo[1] ^ hi[1];
+    r[0] = lo[0];
+    r[1] = lo[1] ^ mid[0];
+    r[2] = hi[0] ^ mid[1];
+    r[3] = hi[1];
+}
+
+/* 256x256 -> 512, portable (Karatsuba over gf_clmul128). */
+static void gf_clmul256_soft(uint64_t r[8], const uint64_t a[4], const uint64_t b[4])
+{
+    uint64_t lo[4], hi[4], mid[4], as[2], bs[2];
+    int i;
+    gf_clmul128(lo, a, b);
+    gf_clmul128(hi, a + 2, b + 2);
+    as[0] = a[0] ^ a[2]; as[1] = a[1] ^ a[3];
+    bs[0] = b[0] ^ b[2]; bs[1] = b[1] ^ b[3];
+    gf_clmul128(mid, as, bs);
+    for (i = 0; i < 4; i++) mid[i] ^= lo[i] ^ hi[i];
+    for (i = 0; i < 4; i++) { r[i] = lo[i]; r[4 + i] = hi[i]; }
+    for (i = 0; i < 4; i++) r[2 + i] ^= mid[i];
+}
+
+#ifdef HERRADURA_HAVE_PCLMUL
+/* 256x256 -> 512 with PCLMULQDQ: 16 64x64 products, schoolbook. */
+__attribute__((target("pclmul,sse2")))
+static void gf_clmul256_pclmul(uint64_t r[8], const uint64_t a[4], const uint64_t b[4])
+{
+    __m128i acc[5], t;
+    int i, j;
+    for (i = 0; i < 5; i++) acc[i] = _mm_setzero_si128();
+    /* acc[k] collects the 128-bit products landing at limb offset 2k and
+       (shifted by one limb) 2k+1; partials at odd offsets are split below. */
+    for (i = 0; i < 4; i++) {
+        __m128i ai = _mm_set_epi64x(0, (long long)a[i]);
+        for (j = 0; j < 4; j++) {
+            t = _mm_clmulepi64_si128(ai, _mm_set_epi64x(0, (long long)b[j]), 0x00);
+            if ((i + j) & 1) {
+                acc[(i + j) >> 1]       = _mm_xor_si128(acc[(i + j) >> 1],
+                                                        _mm_slli_si128(t, 8));
+                acc[((i + j) >> 1) + 1] = _mm_xor_si128(acc[((i + j) >> 1) + 1],
+                                                        _mm_srli_si128(t, 8));
+            } else {
+                acc[(i + j) >> 1] = _mm_xor_si128(acc[(i + j) >> 1], t);
+            }
+        }
+    }
+    for (i = 0; i < 4; i++) {
+        r[2 * i]     = (uint64_t)_mm_cvtsi128_si64(acc[i]);
+        r[2 * i + 1] = (uint64_t)_mm_cvtsi128_si64(_mm_unpackhi_epi64(acc[i], acc[i]));
+    }
+}
+#endif
+
+static void (*gf_clmul256)(uint64_t *, const uint64_t *, const uint64_t *) = gf_clmul256_soft;
+
+static void gf_mul_dispatch_do_init(void)
+{
+#ifdef HERRADURA_HAVE_PCLMUL
+    if (__builtin_cpu_supports("pclmul"))
+        gf_clmul256 = gf_clmul256_pclmul;
+#endif
+}
+
+#ifdef _POSIX_THREADS
+static pthread_once_t gf_mul_once = PTHREAD_ONCE_INIT;
+static void gf_mul_dispatch_init(void) { pthread_once(&gf_mul_once, gf_mul_dispatch_do_init); }
+#else
+/* 0 = uninitialized, 1 = in progress, 2 = done */
+static _Atomic int gf_mul_state = 0;
+static void gf_mul_dispatch_init(void)
+{
+    int expected = 0;
+    if (atomic_load_explicit(&gf_mul_state, memory_order_acquire) == 2) return;
+    if (atomic_compare_exchange_strong_explicit(
+            &gf_mul_state, &expected, 1,
+            memory_order_acq_rel, memory_order_acquire)) {
+        gf_mul_dispatch_do_init();
+        atomic_store_explicit(&gf_mul_state, 2, memory_order_release);
+    } else {
+        while (atomic_load_explicit(&gf_mul_state, memory_order_acquire) != 2) {}
+    }
+}
+#endif
+
+/* Reduce a 512-bit product mod p(x) = x^256 + x^10 + x^5 + x^2 + 1.
+   x^256 ≡ x^10 + x^5 + x^2 + 1, so hi·x^256 folds to hi ⊕ hi<<2 ⊕ hi<<5 ⊕ hi<<10;
+   the ≤10 bits that spill past x^255 fold once more and cannot spill again.
+   Fixed shifts only — constant-time. */
+static inline void gf_reduce512(uint64_t out[4], const uint64_t p[8])
+{
+    const uint64_t *h = p + 4;
+    uint64_t t = (h[3] >> 62) ^ (h[3] >> 59) ^ (h[3] >> 54);
+    int i;
+    for (i = 0; i < 4; i++) {
+        uint64_t hp = i ? h[i - 1] : 0;
+        out[i] = p[i] ^ h[i]
+               ^ (h[i] << 2)  ^ (hp >> 62)
+               ^ (h[i] << 5)  ^ (hp >> 59)
+               ^ (h[i] << 10) ^ (hp >> 54);
+    }
+    out[0] ^= t ^ (t << 2) ^ (t << 5) ^ (t << 10);
+}
+
+/* BitArray <-> little-endian limbs (le[0] holds x^0..x^63) for the GF layer. */
+static inline void gf_le_load(uint64_t le[4], const BitArray *a)
+{
+    BaWords w;
+    int i;
+    baw_load(&w, a);
+    for (i = 0; i < 4; i++) le[i] = w.w[3 - i];
+}
+
+static inline void gf_le_store(BitArray *a, const uint64_t le[4])
+{
+    BaWords w;
+    int i;
+    for (i = 0; i < 4; i++) w.w[3 - i] = le[i];
+    baw_store(a, &w);
+}
+
+/* r = a * b mod GF_POLY on little-endian limbs.  Aliasing is safe. */
+static inline void gf_mul_le(uint64_t r[4], const uint64_t a[4], const uint64_t b[4])
+{
+    uint64_t prod[8];
+    gf_clmul256(prod, a, b);
+    gf_reduce512(r, prod);
+}
+
+/* r = a^2 mod GF_POLY on little-endian limbs.  Squaring is linear over GF(2):
+   bit k moves to bit 2k, so the product is a fixed bit spread plus the usual
+   reduction — no multiply needed, constant-time.  Aliasing is safe. */
+static inline uint64_t gf_spread32(uint32_t v)
+{
+    uint64_t x = v;
+    x = (x | (x << 16)) & UINT64_C(0x0000FFFF0000FFFF);
+    x = (x | (x << 8))  & UINT64_C(0x00FF00FF00FF00FF);
+    x = (x | (x << 4))  & UINT64_C(0x0F0F0F0F0F0F0F0F);
+    x = (x | (x << 2))  & UINT64_C(0x3333333333333333);
+    x = (x | (x << 1))  & UINT64_C(0x5555555555555555);
+    return x;
+}
+
+static inline void gf_sqr_le(uint64_t r[4], const uint64_t a[4])
+{
+    uint64_t prod[8];
+    int i;
+    for (i = 0; i < 4; i++) {
+        prod[2 * i]     = gf_spread32((uint32_t)a[i]);
+        prod[2 * i + 1] = gf_spread32((uint32_t)(a[i] >> 32));
+    }
+    gf_reduce512(r, prod);
+}
+
+/* GF(2^KEYBITS) multiplication: dst = a * b mod GF_POLY.
+   One 256x256 carry-less product (PCLMULQDQ when the CPU has it, otherwise
+   the portable gf_clmul256_soft) and a fixed-shift reduction.  Constant-time
+   on both paths.  Aliasing dst == a or dst == b is safe. */
+static void gf_mul_ba(BitArray *dst, const BitArray *a, const BitArray *b)
+{
+    uint64_t la[4], lb[4];
+    gf_mul_dispatch_init();
+    gf_le_load(la, a);
+    gf_le_load(lb, b);
+    gf_mul_le(la, la, lb);
+    gf_le_store(dst, la);
+}
+
 /* SA-02: constant-time GF(2^KEYBITS) exponentiation.
    Iterates exactly KEYBITS times (no early exit on leading zeros) and
    uses CT select instead of a conditional call, so loop count and
@@ -290,6 +931,208 @@ static void gf_pow_ba(BitArray *dst, const BitArray *base, const BitArray *exp)
     *dst = r;
 }
 
+/* ── Fixed-base exponentiation for g = GF_GEN ─────────────────────────────
+   Table T[j][d] = g^(d·16^j) for j = 0..63, d = 0..15 (32 KiB), built once on
+   first use.  g^e = Π_j T[j][e_j] over the 64 nibbles e_j of e: 63 multiplies,
+   no squarings.  Every lookup scans all 16 entries of its row with a mask, so
+   neither the memory access pattern nor the timing depends on e. */
+
+#define GF_GEN_WIN    4
+#define GF_GEN_TEETH  (KEYBITS / GF_GEN_WIN)   /* 64 */
+
+static uint64_t gf_gen_tbl[GF_GEN_TEETH][1 << GF_GEN_WIN][4];
+
+static void gf_gen_table_do_init(void)
+{
+    uint64_t step[4];
+    int j, d, k;
+    gf_mul_dispatch_init();
+    gf_le_load(step, &GF_GEN);                     /* g^(16^0) */
+    for (j = 0; j < GF_GEN_TEETH; j++) {
+        memset(gf_gen_tbl[j][0], 0, sizeof(gf_gen_tbl[j][0]));
+        gf_gen_tbl[j][0][0] = 1;
+        memcpy(gf_gen_tbl[j][1], step, sizeof(step));
+        for (d = 2; d < (1 << GF_GEN_WIN); d++)
+            gf_mul_le(gf_gen_tbl[j][d], gf_gen_tbl[j][d - 1], step);
+        for (k = 0; k < GF_GEN_WIN; k++)           /* step = g^(16^(j+1)) */
+            gf_sqr_le(step, step);
+    }
+}
+
+#ifdef _POSIX_THREADS
+static pthread_once_t gf_gen_once = PTHREAD_ONCE_INIT;
+static void gf_gen_table_init(void) { pthread_once(&gf_gen_once, gf_gen_table_do_init); }
+#else
+/* 0 = uninitialized, 1 = in progress, 2 = done */
+static _Atomic int gf_gen_state = 0;
+static void gf_gen_table_init(void)
+{
+    int expected = 0;
+    if (atomic_load_explicit(&gf_gen_state, memory_order_acquire) == 2) return;
+    if (atomic_compare_exchange_strong_explicit(
+            &gf_gen_state, &expected, 1,
+            memory_order_acq_rel, memory_order_acquire)) {
+        gf_gen_table_do_init();
+        atomic_store_explicit(&gf_gen_state, 2, memory_order_release);
+    } else {
+        while (atomic_load_explicit(&gf_gen_state, memory_order_acquire) != 2) {}
+    }
+}
+#endif
+
+/* Constant-time row lookup: out = row[idx], touching every entry. */
+static inline void gf_ct_lookup(uint64_t out[4], const uint64_t (*row)[4],
+                                int n, unsigned idx)
+{
+    int d, k;
+    for (k = 0; k < 4; k++) out[k] = 0;
+    for (d = 0; d < n; d++) {
+        uint64_t m = 0 - ((((uint64_t)((unsigned)d ^ idx)) - 1) >> 63);
+        for (k = 0; k < 4; k++) out[k] |= row[d][k] & m;
+    }
+}
+
+/* dst = GF_GEN^exp, constant-time in exp.  Same result as
+   gf_pow_ba(dst, &GF_GEN, exp). */
+static void gf_pow_gen_ba(BitArray *dst, const BitArray *exp)
+{
+    uint64_t r[4], t[4];
+    int j;
+    gf_gen_table_init();
+    gf_ct_lookup(r, (const uint64_t (*)[4])gf_gen_tbl[0], 1 << GF_GEN_WIN,
+                 exp->b[KEYBYTES - 1] & 0x0F);
+    for (j = 1; j < GF_GEN_TEETH; j++) {
+        unsigned nib = (exp->b[KEYBYTES - 1 - (j >> 1)] >> ((j & 1) * 4)) & 0x0F;
+        gf_ct_lookup(t, (const uint64_t (*)[4])gf_gen_tbl[j], 1 << GF_GEN_WIN, nib);
+        gf_mul_le(r, r, t);
+    }
+    gf_le_store(dst, r);
+}
+
+/* ── Fixed-window variable-base exponentiation ─────────────────────────────
+   4-bit windows: a 16-entry per-call table base^0..base^15 (14 multiplies),
+   then 63 × (4 squarings + 1 multiply) — 329 field operations against
+   gf_pow_ba's 512, and the 252 squarings are bit spreads (gf_sqr_le).
+   Every window does its squarings and its multiply, and the table is read
+   with gf_ct_lookup, so timing and access pattern are independent of the
+   exponent (audited alongside gf_pow_ba in dudect_timing_audit.c). */
+
+#define GF_POW_WIN  4
+
+static void gf_pow_win_ba(BitArray *dst, const BitArray *base, const BitArray *exp)
+{
+    uint64_t tbl[1 << GF_POW_WIN][4], r[4], t[4];
+    int d, j, k;
+    gf_mul_dispatch_init();
+    memset(tbl[0], 0, sizeof(tbl[0]));
+    tbl[0][0] = 1;
+    gf_le_load(tbl[1], base);
+    for (d = 2; d < (1 << GF_POW_WIN); d++)
+        gf_mul_le(tbl[d], tbl[d - 1], tbl[1]);
+    gf_ct_lookup(r, (const uint64_t (*)[4])tbl, 1 << GF_POW_WIN, exp->b[0] >> 4);
+    for (j = KEYBITS / GF_POW_WIN - 2; j >= 0; j--) {
+        unsigned nib = (exp->b[KEYBYTES - 1 - (j >> 1)] >> ((j & 1) * 4)) & 0x0F;
+        for (k = 0; k < GF_POW_WIN; k++)
+            gf_sqr_le(r, r);
+        gf_ct_lookup(t, (const uint64_t (*)[4])tbl, 1 << GF_POW_WIN, nib);
+        gf_mul_le(r, r, t);
+    }
+    gf_le_store(dst, r);
+}
+
+/* ── Simultaneous double exponentiation (Straus / Shamir), variable-time ──
+   dst = a^x · b^y with one shared chain of 255 squarings.  Each exponent is
+   recoded into odd sliding windows of width GF_POW2_WIN, and the two digit
+   streams are interleaved over precomputed odd powers a^1, a^3, ..., a^31
+   (likewise for b).  Branches and table indices depend on x and y, so this
+   is for public exponents only — signature verification, never signing. */
+
+#define GF_POW2_WIN  5
+
+/* Sliding-window recoding: dig[i] = odd window value ending at bit i, else 0. */
+static void gf_pow2_recode(uint8_t dig[KEYBITS], const BitArray *e)
+{
+    int i = KEYBITS - 1, j, v;
+    memset(dig, 0, KEYBITS);
+    while (i >= 0) {
+        if (!((e->b[KEYBYTES - 1 - (i >> 3)] >> (i & 7)) & 1)) { i--; continue; }
+        j = i - GF_POW2_WIN + 1;
+        if (j < 0) j = 0;
+        while (!((e->b[KEYBYTES - 1 - (j >> 3)] >> (j & 7)) & 1)) j++;
+        for (v = 0; i >= j; i--)
+            v = (v << 1) | ((e->b[KEYBYTES - 1 - (i >> 3)] >> (i & 7)) & 1);
+        dig[j] = (uint8_t)v;
+    }
+}
+
+/* tbl[k] = base^(2k+1), k = 0 .. 2^(GF_POW2_WIN-1) - 1. */
+static void gf_pow2_odd_table(uint64_t tbl[][4], const BitArray *base)
+{
+    uint64_t sq[4];
+    int k;
+    gf_le_load(tbl[0], base);
+    gf_sqr_le(sq, tbl[0]);
+    for (k = 1; k < (1 << (GF_POW2_WIN - 1)); k++)
+        gf_mul_le(tbl[k], tbl[k - 1], sq);
+}
+
+static void gf_pow2_vartime_ba(BitArray *dst, const BitArray *a, const BitArray *x,
+                               const BitArray *b, const BitArray *y)
+{
+    uint64_t ta[1 << (GF_POW2_WIN - 1)][4], tb[1 << (GF_POW2_WIN - 1)][4], r[4];
+    uint8_t dx[KEYBITS], dy[KEYBITS];
+    int i, started = 0;
+    gf_mul_dispatch_init();
+    gf_pow2_recode(dx, x);
+    gf_pow2_recode(dy, y);
+    gf_pow2_odd_table(ta, a);
+    gf_pow2_odd_table(tb, b);
+    memset(r, 0, sizeof(r));
+    r[0] = 1;
+    for (i = KEYBITS - 1; i >= 0; i--) {
+        if (started) gf_sqr_le(r, r);
+        if (dx[i]) { gf_mul_le(r, r, ta[dx[i] >> 1]); started = 1; }
+        if (dy[i]) { gf_mul_le(r, r, tb[dy[i] >> 1]); started = 1; }
+    }
+    gf_le_store(dst, r);
+}
+
+/* dst = Π bases[j]^exps[j] over n bases — Straus with the same 5-bit sliding
+   windows as gf_pow2_vartime_ba, one squaring chain for all n.  Leading
+   all-zero bit positions cost nothing, so short exponents (e.g. 128-bit batch
+   weights) only pay for their own length.  Variable-time: public inputs only.
+   Returns 1, or 0 (dst untouched) if the per-base tables cannot be allocated. */
+static int gf_multipow_vartime_ba(BitArray *dst, const BitArray *bases,
+                                  const BitArray *exps, size_t n)
+{
+    uint64_t (*tbl)[1 << (GF_POW2_WIN - 1)][4];
+    uint8_t (*dig)[KEYBITS];
+    uint64_t r[4];
+    size_t j;
+    int i, started = 0;
+    gf_mul_dispatch_init();
+    memset(r, 0, sizeof(r));
+    r[0] = 1;
+    if (n == 0) { gf_le_store(dst, r); return 1; }
+    if (n > SIZE_MAX / sizeof(*tbl)) return 0;
+    tbl = malloc(n * sizeof(*tbl));
+    dig = malloc(n * sizeof(*dig));
+    if (!tbl || !dig) { free(tbl); free(dig); return 0; }
+    for (j = 0; j < n; j++) {
+        gf_pow2_recode(dig[j], &exps[j]);
+        gf_pow2_odd_table(tbl[j], &bases[j]);
+    }
+    for (i = KEYBITS - 1; i >= 0; i--) {
+        if (started) gf_sqr_le(r, r);
+        for (j = 0; j < n; j++)
+            if (dig[j][i]) { gf_mul_le(r, r, tbl[j][dig[j][i] >> 1]); started = 1; }
+    }
+    gf_le_store(dst, r);
+    free(tbl);
+    free(dig);
+    return 1;
+}
+
 /* Returns 1 if pub is a valid, non-degenerate GF(2^KEYBITS)* public element:
  * neither the additive zero (not a group element at all) nor the
  * multiplicative identity g^0 = 1.  A pub of 1 collapses HKEX-GF/HPKS/HPKE
@@ -312,24 +1155,20 @@ static int gf_pub_is_valid(const BitArray *pub)
 
 static void ba_add256(BitArray *dst, const BitArray *a, const BitArray *b)
 {
-    uint16_t carry = 0;
-    int i;
-    for (i = KEYBYTES - 1; i >= 0; i--) {
-        uint16_t s = (uint16_t)a->b[i] + b->b[i] + carry;
-        dst->b[i] = (uint8_t)s;
-        carry = s >> 8;
-    }
+    BaWords wa, wb;
+    baw_load(&wa, a);
+    baw_load(&wb, b);
+    baw_add(&wa, &wa, &wb);
+    baw_store(dst, &wa);
 }
 
 static void ba_sub256(BitArray *dst, const BitArray *a, const BitArray *b)
 {
-    int16_t borrow = 0;
-    int i;
-    for (i = KEYBYTES - 1; i >= 0; i--) {
-        int16_t s = (int16_t)a->b[i] - (int16_t)b->b[i] - borrow;
-        dst->b[i] = (uint8_t)(s & 0xFF);
-        borrow = (s < 0) ? 1 : 0;
-    }
+    BaWords wa, wb;
+    baw_load(&wa, a);
+    baw_load(&wb, b);
+    baw_sub(&wa, &wa, &wb);
+    baw_store(dst, &wa);
 }
 
 /* shr1 of big-endian BitArray (right shift by 1 bit, non-destructive) */
@@ -341,15 +1180,6 @@ static void ba_shr1_copy(BitArray *dst, const BitArray *src)
     dst->b[0] = src->b[0] >> 1;
 }
 
-/* ROL by 64 bits on 256-bit big-endian array */
-static void ba_rol64_256(BitArray *dst, const BitArray *src)
-{
-    uint8_t tmp[8];
-    memcpy(tmp, src->b, 8);
-    memcpy(dst->b, src->b + 8, KEYBYTES - 8);
-    memcpy(dst->b + KEYBYTES - 8, tmp, 8);
-}
-
 /* Cyclic left-rotation by k bits on KEYBYTES big-endian array.
    byte_shift = k/8 positions; bit_shift = k%8 bits within each byte. */
 static void ba_rol_k(BitArray *dst, const BitArray *src, int k)
@@ -368,106 +1198,100 @@ static void ba_rol_k(BitArray *dst, const BitArray *src, int k)
     }
 }
 
-/* Low 256-bit schoolbook multiply: dst = a*b mod 2^256 */
+/* Low 256-bit multiply: dst = a*b mod 2^256 (baw_mul_lo) */
 static void ba_mul256(BitArray *dst, const BitArray *a, const BitArray *b)
 {
-    uint64_t acc[KEYBYTES];
-    int i, j;
-    memset(acc, 0, sizeof(acc));
-    for (i = 0; i < KEYBYTES; i++)
-        for (j = 0; j < KEYBYTES - i; j++) {
-            int ridx = KEYBYTES - 1 - i - j;
-            acc[ridx] += (uint64_t)a->b[KEYBYTES - 1 - i] * b->b[KEYBYTES - 1 - j];
-        }
-    {
-        uint64_t carry = 0;
-        for (i = KEYBYTES - 1; i >= 0; i--) {
-            uint64_t s = acc[i] + carry;
-            dst->b[i] = (uint8_t)s;
-            carry = s >> 8;
-        }
-    }
+    BaWords wa, wb;
+    baw_load(&wa, a);
+    baw_load(&wb, b);
+    baw_mul_lo(&wa, &wa, &wb);
+    baw_store(dst, &wa);
 }
 
-/* Full 512-bit schoolbook multiply, then reduce mod (2^256-1).
-   Reduction: (lo + hi) mod (2^256-1), where hi*2^256 + lo = a*b. */
-static void ba_mul_mod_ord(BitArray *dst, const BitArray *a, const BitArray *b)
+/* Scalar arithmetic mod ord = 2^256 − 1 on four 64-bit limbs in gf_le_load
+   order (l[0] = bits 0..63).  2^256 ≡ 1 (mod ord), so a 512-bit product or a
+   257-bit sum reduces by folding the high part onto the low part and adding
+   the carry back in; the fold can never carry twice.  All-ones is the second
+   representation of 0 and is cleared with a mask.  No secret-dependent
+   branches or indices (SA-04). */
+
+/* Map the all-ones limb vector to 0. */
+static inline void ord_canon_le(uint64_t r[4])
 {
-    uint8_t full[2 * KEYBYTES];   /* little-endian 512-bit product */
-    uint8_t lo[KEYBYTES];
-    uint16_t carry;
-    int i, j, all_ff;
+    uint64_t z = ~(r[0] & r[1] & r[2] & r[3]);           /* 0 iff all-ones */
+    uint64_t keep = (uint64_t)0 - ((z | ((uint64_t)0 - z)) >> 63);
+    r[0] &= keep; r[1] &= keep; r[2] &= keep; r[3] &= keep;
+}
 
-    /* SA-04: removed `if (!ai) continue` — unconditional outer loop so
-       execution time does not leak zero bytes in the private key scalar. */
-    memset(full, 0, sizeof(full));
-    for (i = 0; i < KEYBYTES; i++) {
-        uint8_t ai = a->b[KEYBYTES - 1 - i];
-        carry = 0;
-        for (j = 0; j < KEYBYTES; j++) {
-            uint16_t prod = (uint16_t)ai * b->b[KEYBYTES - 1 - j]
-                            + full[i + j] + carry;
-            full[i + j] = (uint8_t)prod;
-            carry = prod >> 8;
-        }
-        {
-            int k;
-            /* SA-04: unconditional carry propagation — no early exit on carry==0 */
-            for (k = i + KEYBYTES; k < 2 * KEYBYTES; k++) {
-                uint16_t s = (uint16_t)full[k] + carry;
-                full[k] = (uint8_t)s;
-                carry = s >> 8;
-            }
-        }
+/* r = lo + hi (mod ord), lo/hi four limbs each. */
+static inline void ord_fold_le(uint64_t r[4], const uint64_t lo[4], const uint64_t hi[4])
+{
+    uint64_t t[4];
+    unsigned char c = 0, c2 = 0;
+    int i;
+    for (i = 0; i < 4; i++) t[i] = baw_adc64(lo[i], hi[i], &c);
+    r[0] = baw_adc64(t[0], c, &c2);         /* end-around carry; cannot carry again */
+    for (i = 1; i < 4; i++) r[i] = baw_adc64(t[i], 0, &c2);
+    ord_canon_le(r);
+}
+
+static inline void ord_mul_le(uint64_t r[4], const uint64_t a[4], const uint64_t b[4])
+{
+    uint64_t t[8] = {0}, c;
+    int i, j;
+    for (i = 0; i < 4; i++) {
+        c = 0;
+        for (j = 0; j < 4; j++)
+            t[i + j] = baw_mac64(t[i + j], a[i], b[j], &c);
+        t[i + 4] = c;
     }
-    carry = 0;
-    for (i = 0; i < KEYBYTES; i++) {
-        uint16_t s = (uint16_t)full[i] + full[KEYBYTES + i] + carry;
-        lo[i] = (uint8_t)s;
-        carry = s >> 8;
-    }
-    if (carry) {
-        carry = 1;
-        /* SA-04: unconditional carry propagation */
-        for (i = 0; i < KEYBYTES; i++) {
-            uint16_t s = (uint16_t)lo[i] + carry;
-            lo[i] = (uint8_t)s;
-            carry = s >> 8;
-        }
-        if (carry) { memset(lo, 0, KEYBYTES); lo[0] = 1; }
-    } else {
-        /* SA-04: no early-exit break in all_ff scan */
-        all_ff = 1;
-        for (i = 0; i < KEYBYTES; i++) all_ff &= (lo[i] == 0xFF);
-        if (all_ff) memset(lo, 0, KEYBYTES);
+    ord_fold_le(r, t, t + 4);
+}
+
+/* r = a² (mod ord): six cross products doubled plus four squares. */
+static inline void ord_sqr_le(uint64_t r[4], const uint64_t a[4])
+{
+    uint64_t t[8] = {0}, c;
+    int i, j;
+    for (i = 0; i < 3; i++) {
+        c = 0;
+        for (j = i + 1; j < 4; j++)
+            t[i + j] = baw_mac64(t[i + j], a[i], a[j], &c);
+        t[i + 4] = c;
     }
-    for (i = 0; i < KEYBYTES; i++)
-        dst->b[KEYBYTES - 1 - i] = lo[i];
+    for (i = 7; i > 0; i--) t[i] = (t[i] << 1) | (t[i - 1] >> 63);
+    c = 0;
+    for (i = 0; i < 4; i++) {
+        unsigned char k = 0;
+        t[2 * i] = baw_mac64(t[2 * i], a[i], a[i], &c);
+        t[2 * i + 1] = baw_adc64(t[2 * i + 1], c, &k);
+        c = k;
+    }
+    ord_fold_le(r, t, t + 4);
 }
 
-/* dst = (a - b) mod (2^256-1) */
+static void ba_mul_mod_ord(BitArray *dst, const BitArray *a, const BitArray *b)
+{
+    uint64_t x[4], y[4], r[4];
+    gf_le_load(x, a);
+    gf_le_load(y, b);
+    ord_mul_le(r, x, y);
+    gf_le_store(dst, r);
+}
+
+/* dst = (a - b) mod (2^256-1): a borrow out of bit 256 is worth −2^256 ≡ −1. */
 static void ba_sub_mod_ord(BitArray *dst, const BitArray *a, const BitArray *b)
 {
-    int16_t borrow = 0;
-    int i, all_ff;
-    for (i = KEYBYTES - 1; i >= 0; i--) {
-        int16_t d = (int16_t)(uint16_t)a->b[i] - (uint16_t)b->b[i] + borrow;
-        dst->b[i] = (uint8_t)d;
-        borrow = d >> 8;
-    }
-    if (borrow) {
-        /* SA-04: CT subtract-1 — propagate borrow unconditionally */
-        uint16_t sub1 = 1;
-        for (i = KEYBYTES - 1; i >= 0; i--) {
-            uint16_t d = (uint16_t)dst->b[i] - sub1;
-            dst->b[i] = (uint8_t)d;
-            sub1 = (d >> 8) & 1u;
-        }
-    }
-    /* SA-04: no early-exit break in all_ff scan */
-    all_ff = 1;
-    for (i = 0; i < KEYBYTES; i++) all_ff &= (dst->b[i] == 0xFF);
-    if (all_ff) memset(dst->b, 0, KEYBYTES);
+    uint64_t x[4], y[4], r[4];
+    unsigned char bw = 0, bw2 = 0;
+    int i;
+    gf_le_load(x, a);
+    gf_le_load(y, b);
+    for (i = 0; i < 4; i++) r[i] = baw_sbb64(x[i], y[i], &bw);
+    r[0] = baw_sbb64(r[0], bw, &bw2);
+    for (i = 1; i < 4; i++) r[i] = baw_sbb64(r[i], 0, &bw2);
+    ord_canon_le(r);
+    gf_le_store(dst, r);
 }
 
 /* ─────────────────────────────────────────────────────────────────────────────
@@ -480,61 +1304,107 @@ static const BitArray ONE_BA  = {{
     0,0,0,0, 0,0,0,0, 0,0,0,0, 0,0,0,0x01
 }};
 
-/* M^{-1} polynomial table for n=256: 256-bit bitmask split into four 64-bit words.
-   Derived from GCD(1+x+x^255, x^256+1) in GF(2)[x]. */
-static const uint64_t MINV256_TBL[4] = {
-    UINT64_C(0xb6db6db6db6db6db),  /* k=0..63   */
-    UINT64_C(0xdb6db6db6db6db6d),  /* k=64..127 */
-    UINT64_C(0x6db6db6db6db6db6),  /* k=128..191 */
-    UINT64_C(0xb6db6db6db6db6db)   /* k=192..255 */
-};
+/* M^{-1} for n=256, derived from GCD(1+x+x^255, x^256+1) in GF(2)[x], is the
+   polynomial with bit k set iff k mod 3 != 2 (the 0xb6db6d... table).  With
+   S = sum_{j=0}^{85} x^{3j} that is S + x·(S + x^255) = S ⊕ x·S ⊕ 1, so
+   M^{-1}·a costs one geometric sum and one rotation.  The sum is built by
+   Horner over the bits of 86 = 0b1010110:
+       S_2m = S_m ⊕ x^{3m}·S_m,   S_m+1 = 1 ⊕ x^3·S_m
+   — ten fixed, public rotations, so constant time in a.  Written out so each
+   rotation distance is a compile-time constant. */
+static inline void baw_xor_rol(BaWords *s, int k)          /* s ^= ROL(s, k) */
+{
+    BaWords t;
+    baw_rol(&t, s, k);
+    s->w[0] ^= t.w[0]; s->w[1] ^= t.w[1]; s->w[2] ^= t.w[2]; s->w[3] ^= t.w[3];
+}
+
+static inline void baw_one_rol3(BaWords *s, const BaWords *a)  /* s = a ⊕ ROL(s, 3) */
+{
+    BaWords t;
+    baw_rol(&t, s, 3);
+    s->w[0] = a->w[0] ^ t.w[0]; s->w[1] = a->w[1] ^ t.w[1];
+    s->w[2] = a->w[2] ^ t.w[2]; s->w[3] = a->w[3] ^ t.w[3];
+}
+
+static inline void baw_m_inv(BaWords *r, const BaWords *a)
+{
+    BaWords s = *a;                                /* S_1  */
+    baw_xor_rol(&s, 3);                            /* S_2  */
+    baw_xor_rol(&s, 6);   baw_one_rol3(&s, a);     /* S_5  */
+    baw_xor_rol(&s, 15);                           /* S_10 */
+    baw_xor_rol(&s, 30);  baw_one_rol3(&s, a);     /* S_21 */
+    baw_xor_rol(&s, 63);  baw_one_rol3(&s, a);     /* S_43 */
+    baw_xor_rol(&s, 129);                          /* S_86 */
+    baw_xor_rol(&s, 1);
+    r->w[0] = s.w[0] ^ a->w[0]; r->w[1] = s.w[1] ^ a->w[1];
+    r->w[2] = s.w[2] ^ a->w[2]; r->w[3] = s.w[3] ^ a->w[3];
+}
 
-/* M^{-1}(x): apply precomputed rotation table (MINV256_TBL). */
+/* M^{-1}(x) */
 static void m_inv_ba(BitArray *result, const BitArray *x)
 {
-    BitArray r, rot;
-    int k;
-    r = *x;   /* k=0 term */
-    for (k = 1; k < KEYBITS; k++) {
-        if ((MINV256_TBL[k >> 6] >> (k & 63)) & 1) {
-            ba_rol_k(&rot, x, k);
-            ba_xor(&r, &r, &rot);
-        }
-    }
-    *result = r;
+    BaWords w;
+    baw_load(&w, x);
+    baw_m_inv(&w, &w);
+    baw_store(result, &w);
+}
+
+/* NL-FSCX v1 on limbs: ROL by n/4 = 64 bits is a one-limb rotation. */
+static inline void baw_nl_fscx_v1(BaWords *r, const BaWords *a, const BaWords *b)
+{
+    BaWords f, s;
+    baw_fscx(&f, a, b);
+    baw_add(&s, a, b);
+    r->w[0] = f.w[0] ^ s.w[1];
+    r->w[1] = f.w[1] ^ s.w[2];
+    r->w[2] = f.w[2] ^ s.w[3];
+    r->w[3] = f.w[3] ^ s.w[0];
 }
 
 /* NL-FSCX v1: fscx(A,B) XOR ROL((A+B) mod 2^n, n/4) */
 static void nl_fscx_v1_ba(BitArray *result, const BitArray *a, const BitArray *b)
 {
-    BitArray f, s, m;
-    ba_fscx(&f, a, b);
-    ba_add256(&s, a, b);
-    ba_rol64_256(&m, &s);
-    ba_xor(result, &f, &m);
+    BaWords wa, wb;
+    baw_load(&wa, a);
+    baw_load(&wb, b);
+    baw_nl_fscx_v1(&wa, &wa, &wb);
+    baw_store(result, &wa);
 }
 
 static void nl_fscx_revolve_v1_ba(BitArray *result, const BitArray *a,
                                    const BitArray *b, int steps)
 {
-    BitArray buf[2];
-    int idx = 0, i;
-    buf[0] = *a;
-    for (i = 0; i < steps; i++) {
-        nl_fscx_v1_ba(&buf[1 - idx], &buf[idx], b);
-        idx ^= 1;
-    }
-    *result = buf[idx];
+    BaWords wa, wb;
+    int i;
+    baw_load(&wa, a);
+    baw_load(&wb, b);
+    for (i = 0; i < steps; i++)
+        baw_nl_fscx_v1(&wa, &wa, &wb);
+    baw_store(result, &wa);
+}
+
+/* delta(B) = ROL(B * floor((B+1)/2) mod 2^n, n/4) on limbs.  B + 1 wraps
+   mod 2^n before the halving, as in the byte-wise definition. */
+static inline void baw_nl_delta_v2(BaWords *d, const BaWords *b)
+{
+    BaWords h, p;
+    unsigned char c = 1;
+    int i;
+    for (i = 3; i >= 0; i--) h.w[i] = baw_adc64(b->w[i], 0, &c);
+    for (i = 3; i > 0; i--) h.w[i] = (h.w[i] >> 1) | (h.w[i - 1] << 63);
+    h.w[0] >>= 1;
+    baw_mul_lo(&p, b, &h);
+    d->w[0] = p.w[1]; d->w[1] = p.w[2]; d->w[2] = p.w[3]; d->w[3] = p.w[0];
 }
 
 /* delta(B) = ROL(B * floor((B+1)/2) mod 2^n, n/4) */
 static void nl_fscx_delta_v2_ba(BitArray *delta, const BitArray *b)
 {
-    BitArray b1, half, prod;
-    ba_add256(&b1, b, &ONE_BA);
-    half = b1; ba_shr1(&half);
-    ba_mul256(&prod, b, &half);
-    ba_rol64_256(delta, &prod);
+    BaWords wb, wd;
+    baw_load(&wb, b);
+    baw_nl_delta_v2(&wd, &wb);
+    baw_store(delta, &wd);
 }
 
 /* Rejects NL-FSCX v2 keys for which the permutation degenerates to affine.
@@ -565,50 +1435,99 @@ static int nl_v2_key_is_valid(const BitArray *b)
 /* NL-FSCX v2: (fscx(A,B) + delta(B)) mod 2^n */
 static void nl_fscx_v2_ba(BitArray *result, const BitArray *a, const BitArray *b)
 {
-    BitArray f, d;
-    ba_fscx(&f, a, b);
-    nl_fscx_delta_v2_ba(&d, b);
-    ba_add256(result, &f, &d);
+    BaWords wa, wb, wd;
+    baw_load(&wa, a);
+    baw_load(&wb, b);
+    baw_nl_delta_v2(&wd, &wb);
+    baw_fscx(&wa, &wa, &wb);
+    baw_add(&wa, &wa, &wd);
+    baw_store(result, &wa);
 }
 
 /* NL-FSCX v2 inverse: A = B XOR M^{-1}((Y - delta(B)) mod 2^n) */
 static void nl_fscx_v2_inv_ba(BitArray *result, const BitArray *y, const BitArray *b)
 {
-    BitArray d, z, mz;
-    nl_fscx_delta_v2_ba(&d, b);
-    ba_sub256(&z, y, &d);
-    m_inv_ba(&mz, &z);
-    ba_xor(result, b, &mz);
+    BaWords wy, wb, wd;
+    int i;
+    baw_load(&wy, y);
+    baw_load(&wb, b);
+    baw_nl_delta_v2(&wd, &wb);
+    baw_sub(&wy, &wy, &wd);
+    baw_m_inv(&wy, &wy);
+    for (i = 0; i < 4; i++) wy.w[i] ^= wb.w[i];
+    baw_store(result, &wy);
+}
+
+/* Keyed NL-FSCX v2 context: B and delta(B) in limbs, built once per key and
+   reused for every block / permutation call under that key.  b is the key
+   itself, so whoever builds a context explicit_bzeros it after the last
+   call: the duplex in _v2dplex_finish, the one-shot wrappers on return. */
+typedef struct {
+    BaWords b;
+    BaWords delta;
+} NlV2Ctx;
+
+static inline void nl_v2_ctx_init(NlV2Ctx *ctx, const BitArray *b)
+{
+    baw_load(&ctx->b, b);
+    baw_nl_delta_v2(&ctx->delta, &ctx->b);
 }
 
-static void nl_fscx_revolve_v2_ba(BitArray *result, const BitArray *a,
-                                   const BitArray *b, int steps)
+/* nl_v2_key_is_valid on the cached delta(B). */
+static inline int nl_v2_ctx_is_valid(const NlV2Ctx *ctx)
 {
-    BitArray buf[2];
-    int idx = 0, i;
-    buf[0] = *a;
+    const BaWords *d = &ctx->delta;
+    uint64_t lo = d->w[1] | d->w[2] | d->w[3];
+    if (!lo && (d->w[0] == 0 || d->w[0] == UINT64_C(0x8000000000000000))) return 0;
+    return 1;
+}
+
+/* result = nl_fscx_revolve_v2(a, B, steps) for the B bound into ctx. */
+static void nl_v2_ctx_revolve(BitArray *result, const BitArray *a,
+                              const NlV2Ctx *ctx, int steps)
+{
+    BaWords wa;
+    int i;
+    baw_load(&wa, a);
     for (i = 0; i < steps; i++) {
-        nl_fscx_v2_ba(&buf[1 - idx], &buf[idx], b);
-        idx ^= 1;
+        baw_fscx(&wa, &wa, &ctx->b);
+        baw_add(&wa, &wa, &ctx->delta);
     }
-    *result = buf[idx];
+    baw_store(result, &wa);
 }
 
-static void nl_fscx_revolve_v2_inv_ba(BitArray *result, const BitArray *y,
-                                       const BitArray *b, int steps)
+/* result = nl_fscx_revolve_v2_inv(y, B, steps) for the B bound into ctx. */
+static void nl_v2_ctx_revolve_inv(BitArray *result, const BitArray *y,
+                                  const NlV2Ctx *ctx, int steps)
 {
-    BitArray delta, buf[2];
-    int idx = 0, i;
-    nl_fscx_delta_v2_ba(&delta, b);   /* precompute once — b is constant */
-    buf[0] = *y;
+    BaWords wy;
+    int i;
+    baw_load(&wy, y);
     for (i = 0; i < steps; i++) {
-        BitArray z, mz;
-        ba_sub256(&z, &buf[idx], &delta);
-        m_inv_ba(&mz, &z);
-        ba_xor(&buf[1 - idx], b, &mz);
-        idx ^= 1;
+        baw_sub(&wy, &wy, &ctx->delta);
+        baw_m_inv(&wy, &wy);
+        wy.w[0] ^= ctx->b.w[0]; wy.w[1] ^= ctx->b.w[1];
+        wy.w[2] ^= ctx->b.w[2]; wy.w[3] ^= ctx->b.w[3];
     }
-    *result = buf[idx];
+    baw_store(result, &wy);
+}
+
+static void nl_fscx_revolve_v2_ba(BitArray *result, const BitArray *a,
+                                   const BitArray *b, int steps)
+{
+    NlV2Ctx ctx;
+    nl_v2_ctx_init(&ctx, b);
+    nl_v2_ctx_revolve(result, a, &ctx, steps);
+    explicit_bzero(&ctx, sizeof ctx);
+}
+
+static void nl_fscx_revolve_v2_inv_ba(BitArray *result, const BitArray *y,
+                                       const BitArray *b, int steps)
+{
+    NlV2Ctx ctx;
+    nl_v2_ctx_init(&ctx, b);
+    nl_v2_ctx_revolve_inv(result, y, &ctx, steps);
+    explicit_bzero(&ctx, sizeof ctx);
 }
 
 /* ─────────────────────────────────────────────────────────────────────────────
@@ -645,111 +1564,781 @@ static void ba_rnl_kdf_seed(BitArray *dst, const BitArray *k)
 
 /* HFSCX-256-DM: Merkle-Damgård hash built on NL-FSCX v1 with Davies-Meyer feed-forward.
  * Compression: C_DM(s,m) = F_1^{64}(s,m) ⊕ s.
- * Bare hash: iv = NULL.  Keyed MAC: iv = key XOR _HFSCX256_IV (32 bytes). */
-static void hfscx_256(const uint8_t *data, size_t len,
-                      const uint8_t *iv, uint8_t out[32])
+ * Padding: data || 0x80 || zeros to a 32-byte boundary, then the length block
+ * (init with bit_length_be64 XOR'd into its last 8 bytes; binds the key and
+ * prevents fixed-point collapse).
+ *
+ * Streaming form: hfscx_256_init / _update / _final buffer at most one 32-byte
+ * block in the context, so any input length hashes in constant memory with no
+ * heap allocation.  final() erases the context. */
+typedef struct {
+    BaWords  s;           /* chaining value */
+    uint8_t  init[32];    /* IV, reused for the length block */
+    uint8_t  buf[32];     /* partial block */
+    size_t   buflen;
+    uint64_t len;         /* bytes absorbed so far */
+} HfscxCtx;
+
+/* C_DM on limbs: s = F_1^{64}(s, m) ⊕ s. */
+static inline void _hfscx_compress(BaWords *s, const uint8_t m[32])
 {
-    const uint8_t *init = iv ? iv : _HFSCX256_IV;
-    BitArray state, block;
-    size_t padded_len, off;
-    uint8_t *padded;
-    uint64_t bit_len;
+    BaWords prev = *s, wm;
     int i;
+    for (i = 0; i < 4; i++) wm.w[i] = baw_be64(m + 8 * i);
+    for (i = 0; i < 64; i++) baw_nl_fscx_v1(s, s, &wm);
+    for (i = 0; i < 4; i++) s->w[i] ^= prev.w[i];
+}
 
-    memcpy(state.b, init, 32);
-
-    /* ISO 7816-4 padding: data || 0x80 || zeros to 32-byte boundary */
-    padded_len = len + 1;
-    if (padded_len % 32) padded_len += 32 - padded_len % 32;
-    padded_len += 32;  /* MD-strengthening length block */
-
-    padded = (uint8_t *)malloc(padded_len);
-    if (!padded) { fprintf(stderr, "hfscx_256: out of memory\n"); exit(1); }
-    if (len) memcpy(padded, data, len);
-    padded[len] = 0x80;
-    memset(padded + len + 1, 0, padded_len - len - 1);
-
-    /* Length block: (bit_length_be64 XOR init) in the last 32 bytes.
-     * XOR with init binds the key and prevents fixed-point collapse. */
-    bit_len = (uint64_t)len * 8;
-    {
-        uint8_t *lb = padded + padded_len - 32;
-        memcpy(lb, init, 32);
-        for (i = 0; i < 8; i++)
-            lb[24 + i] ^= (uint8_t)((bit_len >> (56 - 8 * i)) & 0xFF);
-    }
+/* Bare hash: iv = NULL.  Keyed MAC: iv = key XOR _HFSCX256_IV (32 bytes). */
+static void hfscx_256_init(HfscxCtx *c, const uint8_t *iv)
+{
+    int i;
+    memcpy(c->init, iv ? iv : _HFSCX256_IV, 32);
+    for (i = 0; i < 4; i++) c->s.w[i] = baw_be64(c->init + 8 * i);
+    c->buflen = 0;
+    c->len = 0;
+}
 
-    /* Chain each 32-byte block: C_DM(s,m) = F_1^{64}(s,m) ⊕ s (Davies-Meyer) */
-    for (off = 0; off < padded_len; off += 32) {
-        BitArray prev = state;
-        memcpy(block.b, padded + off, 32);
-        nl_fscx_revolve_v1_ba(&state, &state, &block, 64);
-        ba_xor(&state, &state, &prev);
+static void hfscx_256_update(HfscxCtx *c, const uint8_t *data, size_t len)
+{
+    if (!len) return;
+    c->len += len;
+    if (c->buflen) {
+        size_t take = 32 - c->buflen;
+        if (take > len) take = len;
+        memcpy(c->buf + c->buflen, data, take);
+        c->buflen += take; data += take; len -= take;
+        if (c->buflen < 32) return;
+        _hfscx_compress(&c->s, c->buf);
+        c->buflen = 0;
     }
+    for (; len >= 32; data += 32, len -= 32)
+        _hfscx_compress(&c->s, data);
+    if (len) { memcpy(c->buf, data, len); c->buflen = len; }
+}
 
-    memcpy(out, state.b, 32);
-    free(padded);
+static void hfscx_256_final(HfscxCtx *c, uint8_t out[32])
+{
+    uint64_t bit_len = c->len * 8;
+    int i;
+    c->buf[c->buflen] = 0x80;                /* buflen < 32 between calls */
+    memset(c->buf + c->buflen + 1, 0, 31 - c->buflen);
+    _hfscx_compress(&c->s, c->buf);
+    memcpy(c->buf, c->init, 32);
+    for (i = 0; i < 8; i++)
+        c->buf[24 + i] ^= (uint8_t)((bit_len >> (56 - 8 * i)) & 0xFF);
+    _hfscx_compress(&c->s, c->buf);
+    for (i = 0; i < 4; i++) baw_put_be64(out + 8 * i, c->s.w[i]);
+    explicit_bzero(c, sizeof(*c));
+}
+
+/* One-shot HFSCX-256-DM. */
+static void hfscx_256(const uint8_t *data, size_t len,
+                      const uint8_t *iv, uint8_t out[32])
+{
+    HfscxCtx c;
+    hfscx_256_init(&c, iv);
+    hfscx_256_update(&c, data, len);
+    hfscx_256_final(&c, out);
 }
 
 /* HFSCX-256-DS: domain-separated variant — prepends a 1-byte tag before hashing.
  * ds=0x01 for generic digest, 0x02 for sign pre-hash, 0x03 for AEAD-MAC.
  * Wire-format option HFSCX-256-DS (§11.9.7 future hardening, TODO #93). */
+static void hfscx_256_ds_init(HfscxCtx *c, uint8_t ds, const uint8_t *iv)
+{
+    hfscx_256_init(c, iv);
+    hfscx_256_update(c, &ds, 1);
+}
+
 static void hfscx_256_ds(uint8_t ds, const uint8_t *data, size_t len,
                           const uint8_t *iv, uint8_t out[32])
 {
-    uint8_t *buf = (uint8_t *)malloc(1 + len);
-    if (!buf) { fprintf(stderr, "hfscx_256_ds: out of memory\n"); exit(1); }
-    buf[0] = ds;
-    if (len) memcpy(buf + 1, data, len);
-    hfscx_256(buf, 1 + len, iv, out);
-    free(buf);
+    HfscxCtx c;
+    hfscx_256_ds_init(&c, ds, iv);
+    hfscx_256_update(&c, data, len);
+    hfscx_256_final(&c, out);
 }
 
 /* HMAC-HFSCX-256-DM: HMAC construction over HFSCX-256-DM (§11.9.6).
  * Recommended for cross-protocol key reuse.
  * HMAC(K, D) = HFSCX-256((K^opad) || HFSCX-256((K^ipad) || D))
- * ipad = 0x36 repeated 32 bytes, opad = 0x5C repeated 32 bytes. */
+ * ipad = 0x36 repeated 32 bytes, opad = 0x5C repeated 32 bytes.
+ *
+ * K^ipad and K^opad are exactly one block each, so HmacHfscxKey stores the
+ * two midstates after absorbing them; each message then starts from a copy
+ * and skips both key-block compressions.  The midstates let anyone MAC under
+ * K, so the owner explicit_bzeros the HmacHfscxKey once K is retired, as
+ * hmac_hfscx_256 does with its one-shot key. */
+typedef struct {
+    HfscxCtx inner;
+    HfscxCtx outer;
+} HmacHfscxKey;
+
+static void hmac_hfscx_key_init(HmacHfscxKey *k, const uint8_t key[32])
+{
+    uint8_t pad[32];
+    int i;
+    for (i = 0; i < 32; i++) pad[i] = key[i] ^ 0x36;
+    hfscx_256_init(&k->inner, NULL);
+    hfscx_256_update(&k->inner, pad, 32);
+    for (i = 0; i < 32; i++) pad[i] = key[i] ^ 0x5C;
+    hfscx_256_init(&k->outer, NULL);
+    hfscx_256_update(&k->outer, pad, 32);
+    explicit_bzero(pad, sizeof pad);
+}
+
+/* Streaming MAC: hmac_hfscx_init, then hfscx_256_update on c, then
+ * hmac_hfscx_final.  k is only read, so one key serves any number of
+ * concurrent messages. */
+static inline void hmac_hfscx_init(HfscxCtx *c, const HmacHfscxKey *k)
+{
+    *c = k->inner;
+}
+
+static void hmac_hfscx_final(HfscxCtx *c, const HmacHfscxKey *k, uint8_t out[32])
+{
+    uint8_t inner[32];
+    HfscxCtx o = k->outer;
+    hfscx_256_final(c, inner);
+    hfscx_256_update(&o, inner, 32);
+    hfscx_256_final(&o, out);
+    explicit_bzero(inner, sizeof inner);
+}
+
+static void hmac_hfscx_256_k(const HmacHfscxKey *k, const uint8_t *data, size_t len,
+                             uint8_t out[32])
+{
+    HfscxCtx c;
+    hmac_hfscx_init(&c, k);
+    hfscx_256_update(&c, data, len);
+    hmac_hfscx_final(&c, k, out);
+}
+
 static void hmac_hfscx_256(const uint8_t key[32], const uint8_t *data, size_t len,
                              uint8_t out[32])
 {
-    uint8_t ipad_key[32], opad_key[32], inner[32], obuf[64];
-    uint8_t *ibuf;
+    HmacHfscxKey k;
+    hmac_hfscx_key_init(&k, key);
+    hmac_hfscx_256_k(&k, data, len, out);
+    explicit_bzero(&k, sizeof k);
+}
+
+/* ── Multi-buffer HFSCX-256 ────────────────────────────────────────────────
+   Merkle-Damgård chains cannot be split, but independent messages can run side
+   by side: HfscxCtxX hashes up to HFSCX_MB_LANES equal-length messages in
+   lockstep, one message per lane.  With AVX2 each 256-bit vector holds the
+   same limb of four lanes, so one NL-FSCX v1 round advances four chains; eight
+   lanes run as two interleaved groups to hide the round's dependency chain.
+   The portable backend runs the lanes one after another.  Output per lane is
+   identical to hfscx_256 of that lane's input. */
+
+#define HFSCX_MB_LANES 8
+
+typedef struct {
+    BaWords  s[HFSCX_MB_LANES];
+    uint8_t  init[32];
+    uint8_t  buf[HFSCX_MB_LANES][32];
+    size_t   buflen;
+    uint64_t len;
+    int      lanes;
+} HfscxCtxX;
+
+static void _hfscx_compress_mb_soft(BaWords *s, const uint8_t *const m[], int lanes)
+{
+    int j;
+    for (j = 0; j < lanes; j++) _hfscx_compress(&s[j], m[j]);
+}
+
+/* v[j] = NL-FSCX v1 revolve of v[j] under m[j], steps rounds, for up to
+   HFSCX_MB_LANES independent lanes (the HSKE-NL-A1 CTR keystream: one lane
+   per counter block).  The portable backend steps the lanes round by round
+   so their dependency chains overlap in the out-of-order window. */
+static void _nl_v1_revolve_mb_soft(BaWords *v, const BaWords *m, int lanes, int steps)
+{
+    int r, j;
+    for (r = 0; r < steps; r++)
+        for (j = 0; j < lanes; j++) baw_nl_fscx_v1(&v[j], &v[j], &m[j]);
+}
+
+#ifdef HERRADURA_HAVE_AVX2
+/* Unsigned 64-bit a < b per lane, as an all-ones mask. */
+__attribute__((target("avx2")))
+static inline __m256i _mb_ltu(__m256i a, __m256i b)
+{
+    const __m256i sg = _mm256_set1_epi64x((long long)UINT64_C(0x8000000000000000));
+    return _mm256_cmpgt_epi64(_mm256_xor_si256(b, sg), _mm256_xor_si256(a, sg));
+}
+
+/* One NL-FSCX v1 step (baw_nl_fscx_v1) on four lanes; v[i] holds limb i. */
+__attribute__((target("avx2")))
+static inline void _mb_nl_v1(__m256i v[4], const __m256i m[4])
+{
+    __m256i x[4], f[4], t, c, c2, sum[4];
+    int i;
+    for (i = 0; i < 4; i++) x[i] = _mm256_xor_si256(v[i], m[i]);
+    for (i = 0; i < 4; i++) {
+        __m256i l = _mm256_or_si256(_mm256_slli_epi64(x[i], 1),
+                                    _mm256_srli_epi64(x[(i + 1) & 3], 63));
+        __m256i r = _mm256_or_si256(_mm256_srli_epi64(x[i], 1),
+                                    _mm256_slli_epi64(x[(i + 3) & 3], 63));
+        f[i] = _mm256_xor_si256(x[i], _mm256_xor_si256(l, r));
+    }
+    /* (v + m) mod 2^256, limb 3 least significant; carries are -1 masks. */
+    sum[3] = _mm256_add_epi64(v[3], m[3]);
+    c = _mb_ltu(sum[3], v[3]);
+    for (i = 2; i >= 0; i--) {
+        t  = _mm256_add_epi64(v[i], m[i]);
+        c2 = _mb_ltu(t, v[i]);
+        sum[i] = _mm256_sub_epi64(t, c);
+        c = _mm256_or_si256(c2, _mb_ltu(sum[i], t));
+    }
+    for (i = 0; i < 4; i++) v[i] = _mm256_xor_si256(f[i], sum[(i + 1) & 3]);
+}
+
+__attribute__((target("avx2")))
+static inline void _mb_load4(__m256i v[4], const uint64_t w[4][4])
+{
     int i;
-    for (i = 0; i < 32; i++) {
-        ipad_key[i] = key[i] ^ 0x36;
-        opad_key[i] = key[i] ^ 0x5C;
+    for (i = 0; i < 4; i++)
+        v[i] = _mm256_set_epi64x((long long)w[3][i], (long long)w[2][i],
+                                 (long long)w[1][i], (long long)w[0][i]);
+}
+
+__attribute__((target("avx2")))
+static inline void _mb_store4(uint64_t w[4][4], const __m256i v[4])
+{
+    uint64_t t[4];
+    int i, j;
+    for (i = 0; i < 4; i++) {
+        _mm256_storeu_si256((__m256i *)t, v[i]);
+        for (j = 0; j < 4; j++) w[j][i] = t[j];
+    }
+    explicit_bzero(t, sizeof t);
+}
+
+/* Davies-Meyer over up to eight lanes; missing lanes replay lane 0. */
+__attribute__((target("avx2")))
+static void _hfscx_compress_mb_avx2(BaWords *s, const uint8_t *const m[], int lanes)
+{
+    uint64_t sw[2][4][4], mw[2][4][4];
+    __m256i va[4], vb[4], ma[4], mb[4], pa[4], pb[4];
+    int groups = lanes > 4 ? 2 : 1, g, j, i, r;
+    for (g = 0; g < 2; g++)
+        for (j = 0; j < 4; j++) {
+            int ln = 4 * g + j < lanes ? 4 * g + j : 0;
+            for (i = 0; i < 4; i++) {
+                sw[g][j][i] = s[ln].w[i];
+                mw[g][j][i] = baw_be64(m[ln] + 8 * i);
+            }
+        }
+    _mb_load4(va, sw[0]); _mb_load4(ma, mw[0]);
+    _mb_load4(vb, sw[1]); _mb_load4(mb, mw[1]);
+    for (i = 0; i < 4; i++) { pa[i] = va[i]; pb[i] = vb[i]; }
+    if (groups == 2) {
+        for (r = 0; r < 64; r++) { _mb_nl_v1(va, ma); _mb_nl_v1(vb, mb); }
+    } else {
+        for (r = 0; r < 64; r++) _mb_nl_v1(va, ma);
+    }
+    for (i = 0; i < 4; i++) {
+        va[i] = _mm256_xor_si256(va[i], pa[i]);
+        vb[i] = _mm256_xor_si256(vb[i], pb[i]);
+    }
+    _mb_store4(sw[0], va);
+    _mb_store4(sw[1], vb);
+    for (j = 0; j < lanes; j++)
+        for (i = 0; i < 4; i++) s[j].w[i] = sw[j >> 2][j & 3][i];
+}
+
+/* _nl_v1_revolve_mb on four-lane vectors; missing lanes replay lane 0. */
+__attribute__((target("avx2")))
+static void _nl_v1_revolve_mb_avx2(BaWords *v, const BaWords *m, int lanes, int steps)
+{
+    uint64_t vw[2][4][4], mw[2][4][4];
+    __m256i va[4], vb[4], ma[4], mb[4];
+    int groups = lanes > 4 ? 2 : 1, g, j, i, r;
+    for (g = 0; g < 2; g++)
+        for (j = 0; j < 4; j++) {
+            int ln = 4 * g + j < lanes ? 4 * g + j : 0;
+            for (i = 0; i < 4; i++) {
+                vw[g][j][i] = v[ln].w[i];
+                mw[g][j][i] = m[ln].w[i];
+            }
+        }
+    _mb_load4(va, vw[0]); _mb_load4(ma, mw[0]);
+    _mb_load4(vb, vw[1]); _mb_load4(mb, mw[1]);
+    if (groups == 2) {
+        for (r = 0; r < steps; r++) { _mb_nl_v1(va, ma); _mb_nl_v1(vb, mb); }
+    } else {
+        for (r = 0; r < steps; r++) _mb_nl_v1(va, ma);
+    }
+    _mb_store4(vw[0], va);
+    _mb_store4(vw[1], vb);
+    for (j = 0; j < lanes; j++)
+        for (i = 0; i < 4; i++) v[j].w[i] = vw[j >> 2][j & 3][i];
+    /* The lanes carry keystream state and key-derived inputs. */
+    explicit_bzero(vw, sizeof vw); explicit_bzero(mw, sizeof mw);
+    explicit_bzero(va, sizeof va); explicit_bzero(vb, sizeof vb);
+    explicit_bzero(ma, sizeof ma); explicit_bzero(mb, sizeof mb);
+}
+#endif
+
+static void (*_hfscx_compress_mb)(BaWords *, const uint8_t *const[], int) =
+    _hfscx_compress_mb_soft;
+static void (*_nl_v1_revolve_mb)(BaWords *, const BaWords *, int, int) =
+    _nl_v1_revolve_mb_soft;
+
+static void hfscx_mb_dispatch_do_init(void)
+{
+#ifdef HERRADURA_HAVE_AVX2
+    if (__builtin_cpu_supports("avx2")) {
+        _hfscx_compress_mb = _hfscx_compress_mb_avx2;
+        _nl_v1_revolve_mb = _nl_v1_revolve_mb_avx2;
+    }
+#endif
+}
+
+#ifdef _POSIX_THREADS
+static pthread_once_t hfscx_mb_once = PTHREAD_ONCE_INIT;
+static void hfscx_mb_dispatch_init(void) { pthread_once(&hfscx_mb_once, hfscx_mb_dispatch_do_init); }
+#else
+/* 0 = uninitialized, 1 = in progress, 2 = done */
+static _Atomic int hfscx_mb_state = 0;
+static void hfscx_mb_dispatch_init(void)
+{
+    int expected = 0;
+    if (atomic_load_explicit(&hfscx_mb_state, memory_order_acquire) == 2) return;
+    if (atomic_compare_exchange_strong_explicit(
+            &hfscx_mb_state, &expected, 1,
+            memory_order_acq_rel, memory_order_acquire)) {
+        hfscx_mb_dispatch_do_init();
+        atomic_store_explicit(&hfscx_mb_state, 2, memory_order_release);
+    } else {
+        while (atomic_load_explicit(&hfscx_mb_state, memory_order_acquire) != 2) {}
+    }
+}
+#endif
+
+/* lanes in 1..HFSCX_MB_LANES; every lane shares iv. */
+static void hfscx_256_xn_init(HfscxCtxX *c, int lanes, const uint8_t *iv)
+{
+    int i, j;
+    hfscx_mb_dispatch_init();
+    memcpy(c->init, iv ? iv : _HFSCX256_IV, 32);
+    for (j = 0; j < lanes; j++)
+        for (i = 0; i < 4; i++) c->s[j].w[i] = baw_be64(c->init + 8 * i);
+    c->lanes = lanes;
+    c->buflen = 0;
+    c->len = 0;
+}
+
+/* Absorb len bytes from data[j] into lane j, for every lane. */
+static void hfscx_256_xn_update(HfscxCtxX *c, const uint8_t *const data[], size_t len)
+{
+    const uint8_t *blk[HFSCX_MB_LANES];
+    size_t off = 0;
+    int j;
+    if (!len) return;
+    c->len += len;
+    if (c->buflen) {
+        size_t take = 32 - c->buflen;
+        if (take > len) take = len;
+        for (j = 0; j < c->lanes; j++) memcpy(c->buf[j] + c->buflen, data[j], take);
+        c->buflen += take; off = take;
+        if (c->buflen < 32) return;
+        for (j = 0; j < c->lanes; j++) blk[j] = c->buf[j];
+        _hfscx_compress_mb(c->s, blk, c->lanes);
+        c->buflen = 0;
+    }
+    for (; len - off >= 32; off += 32) {
+        for (j = 0; j < c->lanes; j++) blk[j] = data[j] + off;
+        _hfscx_compress_mb(c->s, blk, c->lanes);
+    }
+    if (len > off) {
+        for (j = 0; j < c->lanes; j++) memcpy(c->buf[j], data[j] + off, len - off);
+        c->buflen = len - off;
     }
-    ibuf = (uint8_t *)malloc(32 + len);
-    if (!ibuf) { fprintf(stderr, "hmac_hfscx_256: out of memory\n"); exit(1); }
-    memcpy(ibuf, ipad_key, 32);
-    if (len) memcpy(ibuf + 32, data, len);
-    hfscx_256(ibuf, 32 + len, NULL, inner);
-    free(ibuf);
-    memcpy(obuf, opad_key, 32);
-    memcpy(obuf + 32, inner, 32);
-    hfscx_256(obuf, 64, NULL, out);
 }
 
-/* HSKE-NL-A1 CTR-mode AEAD helpers for encfile/decfile.
- * Caller computes: base = K XOR nonce; seed = ba_rnl_kdf_seed(base).
- * Block counter i is XOR'd into the four least-significant bytes of base. */
-static void hske_nla1_ks_block(const BitArray *seed, const BitArray *base,
-                                uint32_t i, BitArray *ks_out)
+static void hfscx_256_xn_final(HfscxCtxX *c, uint8_t *const out[])
+{
+    const uint8_t *blk[HFSCX_MB_LANES];
+    uint64_t bit_len = c->len * 8;
+    int i, j;
+    for (j = 0; j < c->lanes; j++) {
+        c->buf[j][c->buflen] = 0x80;
+        memset(c->buf[j] + c->buflen + 1, 0, 31 - c->buflen);
+        blk[j] = c->buf[j];
+    }
+    _hfscx_compress_mb(c->s, blk, c->lanes);
+    memcpy(c->buf[0], c->init, 32);
+    for (i = 0; i < 8; i++)
+        c->buf[0][24 + i] ^= (uint8_t)((bit_len >> (56 - 8 * i)) & 0xFF);
+    for (j = 0; j < c->lanes; j++) blk[j] = c->buf[0];   /* same length block */
+    _hfscx_compress_mb(c->s, blk, c->lanes);
+    for (j = 0; j < c->lanes; j++)
+        for (i = 0; i < 4; i++) baw_put_be64(out[j] + 8 * i, c->s[j].w[i]);
+    explicit_bzero(c, sizeof(*c));
+}
+
+/* out[j] = HFSCX-256(data[j]) for lanes equal-length messages. */
+static void hfscx_256_xn(const uint8_t *const data[], int lanes, size_t len,
+                         const uint8_t *iv, uint8_t *const out[])
+{
+    HfscxCtxX c;
+    hfscx_256_xn_init(&c, lanes, iv);
+    hfscx_256_xn_update(&c, data, len);
+    hfscx_256_xn_final(&c, out);
+}
+
+static inline void hfscx_256_x4(const uint8_t *const data[4], size_t len,
+                                const uint8_t *iv, uint8_t *const out[4])
+{
+    hfscx_256_xn(data, 4, len, iv, out);
+}
+
+static inline void hfscx_256_x8(const uint8_t *const data[8], size_t len,
+                                const uint8_t *iv, uint8_t *const out[8])
+{
+    hfscx_256_xn(data, 8, len, iv, out);
+}
+
+/* ─────────────────────────────────────────────────────────────────────────────
+ * ParPool: fork-join worker pool for data-parallel jobs
+ *
+ * par_pool_run(p, fn, arg) calls fn(arg, k, n) once for every k in [0, n) —
+ * k = 0 on the calling thread, the rest on the pool's parked workers — and
+ * returns when all of them are done.  Workers are created once by
+ * par_pool_init and reused for every run.  Without POSIX threads, or when a
+ * thread cannot be created, the pool degrades to fewer workers (n = 1 at
+ * worst) and jobs must not assume a particular n.
+ * ───────────────────────────────────────────────────────────────────────────── */
+
+typedef void (*ParJobFn)(void *arg, int k, int n);
+
+typedef struct ParPool ParPool;
+#ifdef _POSIX_THREADS
+typedef struct { ParPool *p; int k; pthread_t tid; } _ParSlot;
+#endif
+
+struct ParPool {
+    int n;
+#ifdef _POSIX_THREADS
+    _ParSlot *slot;
+    pthread_mutex_t mu;
+    pthread_cond_t go, done;
+    unsigned long gen;
+    int busy, stop;
+    ParJobFn fn;
+    void *arg;
+#endif
+};
+
+#ifdef _POSIX_THREADS
+static void *_par_worker(void *v)
+{
+    _ParSlot *s = (_ParSlot *)v;
+    ParPool *p = s->p;
+    unsigned long seen = 0;
+    for (;;) {
+        ParJobFn fn;
+        void *arg;
+        pthread_mutex_lock(&p->mu);
+        while (p->gen == seen && !p->stop) pthread_cond_wait(&p->go, &p->mu);
+        if (p->stop) { pthread_mutex_unlock(&p->mu); return NULL; }
+        seen = p->gen; fn = p->fn; arg = p->arg;
+        pthread_mutex_unlock(&p->mu);
+        fn(arg, s->k, p->n);
+        pthread_mutex_lock(&p->mu);
+        if (--p->busy == 0) pthread_cond_signal(&p->done);
+        pthread_mutex_unlock(&p->mu);
+    }
+}
+#endif
+
+static void par_pool_init(ParPool *p, int nthreads)
+{
+    memset(p, 0, sizeof *p);
+    p->n = 1;
+#ifdef _POSIX_THREADS
+    if (nthreads > 1) {
+        int k;
+        p->slot = (_ParSlot *)calloc((size_t)nthreads, sizeof *p->slot);
+        if (!p->slot) return;
+        pthread_mutex_init(&p->mu, NULL);
+        pthread_cond_init(&p->go, NULL);
+        pthread_cond_init(&p->done, NULL);
+        for (k = 1; k < nthreads; k++) {
+            p->slot[k].p = p; p->slot[k].k = k;
+            if (pthread_create(&p->slot[k].tid, NULL, _par_worker, &p->slot[k]) != 0) break;
+        }
+        p->n = k;
+    }
+#else
+    (void)nthreads;
+#endif
+}
+
+static void par_pool_run(ParPool *p, ParJobFn fn, void *arg)
+{
+#ifdef _POSIX_THREADS
+    if (p->n > 1) {
+        pthread_mutex_lock(&p->mu);
+        p->fn = fn; p->arg = arg; p->busy = p->n - 1; p->gen++;
+        pthread_cond_broadcast(&p->go);
+        pthread_mutex_unlock(&p->mu);
+        fn(arg, 0, p->n);
+        pthread_mutex_lock(&p->mu);
+        while (p->busy) pthread_cond_wait(&p->done, &p->mu);
+        pthread_mutex_unlock(&p->mu);
+        return;
+    }
+#endif
+    fn(arg, 0, 1);
+}
+
+static void par_pool_free(ParPool *p)
+{
+#ifdef _POSIX_THREADS
+    if (p->slot) {
+        int k;
+        pthread_mutex_lock(&p->mu);
+        p->stop = 1;
+        pthread_cond_broadcast(&p->go);
+        pthread_mutex_unlock(&p->mu);
+        for (k = 1; k < p->n; k++) pthread_join(p->slot[k].tid, NULL);
+        pthread_cond_destroy(&p->go);
+        pthread_cond_destroy(&p->done);
+        pthread_mutex_destroy(&p->mu);
+        free(p->slot);
+    }
+#endif
+    memset(p, 0, sizeof *p);
+}
+
+/* HSKE-NL-A1 CTR-mode AEAD helpers for encfile/decfile.
+ * Caller computes: base = K XOR nonce; seed = ba_rnl_kdf_seed(base).
+ * Block counter i is XOR'd into the four least-significant bytes of base. */
+static void hske_nla1_ks_block(const BitArray *seed, const BitArray *base,
+                                uint32_t i, BitArray *ks_out)
+{
+    BitArray base_i = *base;
+    base_i.b[KEYBYTES-4] ^= (uint8_t)((i >> 24) & 0xFF);
+    base_i.b[KEYBYTES-3] ^= (uint8_t)((i >> 16) & 0xFF);
+    base_i.b[KEYBYTES-2] ^= (uint8_t)((i >>  8) & 0xFF);
+    base_i.b[KEYBYTES-1] ^= (uint8_t)( i        & 0xFF);
+    nl_fscx_revolve_v1_ba(ks_out, seed, &base_i, I_VALUE);
+}
+
+static void hske_nla1_mac_key(const BitArray *seed, const BitArray *base,
+                               BitArray *mac_key_out)
+{
+    BitArray seed2;
+    ba_rol_k(&seed2, seed, KEYBITS / 4);
+    nl_fscx_revolve_v1_ba(mac_key_out, &seed2, base, I_VALUE);
+}
+
+/* XOR len bytes of the HSKE-NL-A1 keystream into out, starting at block
+ * counter blk0 (byte offset 32*blk0 of the stream).  in and out may alias.
+ * Up to HFSCX_MB_LANES counter blocks are revolved in lockstep; each lane is
+ * hske_nla1_ks_block of its counter, so the stream is unchanged. */
+static void hske_nla1_xor_ks(const BitArray *seed, const BitArray *base,
+                             uint32_t blk0, const uint8_t *in, size_t len,
+                             uint8_t *out)
+{
+    BaWords s0, b0, v[HFSCX_MB_LANES], m[HFSCX_MB_LANES];
+    BitArray ks[HFSCX_MB_LANES];
+    size_t off = 0, take, j;
+    uint32_t i = blk0;
+    int lanes, k;
+    hfscx_mb_dispatch_init();
+    baw_load(&s0, seed);
+    baw_load(&b0, base);
+    while (off < len) {
+        size_t nblk = (len - off + KEYBYTES - 1) / KEYBYTES;
+        lanes = nblk < HFSCX_MB_LANES ? (int)nblk : HFSCX_MB_LANES;
+        for (k = 0; k < lanes; k++) {
+            v[k] = s0;
+            m[k] = b0;
+            m[k].w[3] ^= (uint32_t)(i + (uint32_t)k);   /* bytes 28..31 */
+        }
+        _nl_v1_revolve_mb(v, m, lanes, I_VALUE);
+        for (k = 0; k < lanes; k++) baw_store(&ks[k], &v[k]);
+        take = (size_t)lanes * KEYBYTES;
+        if (take > len - off) take = len - off;
+        for (j = 0; j < take; j++) out[off + j] = in[off + j] ^ ks[j / KEYBYTES].b[j % KEYBYTES];
+        off += take;
+        i += (uint32_t)lanes;
+    }
+    explicit_bzero(ks, sizeof ks);
+    explicit_bzero(v, sizeof v);
+    explicit_bzero(m, sizeof m);
+    explicit_bzero(&s0, sizeof s0);
+    explicit_bzero(&b0, sizeof b0);
+}
+
+typedef struct {
+    const BitArray *seed, *base;
+    uint32_t blk0;
+    const uint8_t *in;
+    uint8_t *out;
+    size_t len;
+} _Nla1KsJob;
+
+static void _hske_nla1_ks_job(void *v, int k, int n)
+{
+    const _Nla1KsJob *j = (const _Nla1KsJob *)v;
+    size_t nblk = (j->len + KEYBYTES - 1) / KEYBYTES;
+    size_t b0 = nblk * (size_t)k / (size_t)n, b1 = nblk * (size_t)(k + 1) / (size_t)n;
+    size_t off = b0 * KEYBYTES, end = b1 * KEYBYTES;
+    if (end > j->len) end = j->len;
+    if (off < end)
+        hske_nla1_xor_ks(j->seed, j->base, j->blk0 + (uint32_t)b0,
+                         j->in + off, end - off, j->out + off);
+}
+
+/* hske_nla1_xor_ks with the block range split evenly across the pool.  Each
+ * block depends only on its counter, so the output is identical to the
+ * serial call for any pool size. */
+static void hske_nla1_xor_ks_par(ParPool *pool, const BitArray *seed,
+                                 const BitArray *base, uint32_t blk0,
+                                 const uint8_t *in, size_t len, uint8_t *out)
+{
+    _Nla1KsJob j;
+    j.seed = seed; j.base = base; j.blk0 = blk0;
+    j.in = in; j.out = out; j.len = len;
+    par_pool_run(pool, _hske_nla1_ks_job, &j);
+}
+
+/* ─────────────────────────────────────────────────────────────────────────────
+ * HKX2 segmented .hkx container
+ *
+ *   header:  "HKX2" | algo 0x01 | seg_size_be4 | nonce(32)
+ *   body:    seg_0 | seg_1 | ... | seg_last,   seg_i = ct_i | tag_i(32)
+ *
+ * Every segment but the last carries exactly seg_size ciphertext bytes; the
+ * last carries 0..seg_size (an empty file is one empty final segment).  The
+ * keystream is the HKX1 one, so segment i starts at block i*seg_size/32 and
+ * the stream is capped at 2^32 blocks (128 GiB).  Each segment is tagged
+ * independently under the HKX1 mac_key schedule:
+ *   tag_i = HFSCX-256-MAC(mac_key XOR IV,
+ *               DS || nonce || seg_size_be4 || i_be8 || final(1) || ct_i)
+ * The index stops reordering and the final flag stops truncation at a
+ * segment boundary, so a reader can verify and release one segment at a time
+ * while holding a single segment in memory.
+ * ───────────────────────────────────────────────────────────────────────────── */
+
+#define HKX2_SEG_DS      "HKX2-SEG"
+#define HKX2_SEG_DS_LEN  8
+#define HKX2_HDR_LEN     41
+#define HKX2_SEG_DEFAULT 65536u
+#define HKX2_SEG_MAX     (1u << 24)
+
+/* Valid segment sizes are whole keystream blocks in [32, HKX2_SEG_MAX]. */
+static int hkx2_seg_size_ok(uint32_t seg_size)
+{
+    return seg_size >= KEYBYTES && seg_size <= HKX2_SEG_MAX &&
+           seg_size % KEYBYTES == 0;
+}
+
+/* Absorb the per-file tag prefix (DS || nonce || seg_size) once; every
+ * segment tag resumes from this midstate.  The midstate is keyed by mac_key
+ * and can forge tags for the file: the caller wipes *pre after the last
+ * segment. */
+static void hkx2_tag_init(HfscxCtx *pre, const BitArray *mac_key,
+                          const BitArray *nonce, uint32_t seg_size)
+{
+    uint8_t mac_iv[32], sb[4];
+    int j;
+    for (j = 0; j < 32; j++) mac_iv[j] = mac_key->b[j] ^ _HFSCX256_IV[j];
+    hfscx_256_init(pre, mac_iv);
+    hfscx_256_update(pre, (const uint8_t *)HKX2_SEG_DS, HKX2_SEG_DS_LEN);
+    hfscx_256_update(pre, nonce->b, KEYBYTES);
+    for (j = 0; j < 4; j++) sb[j] = (uint8_t)(seg_size >> (24 - 8 * j));
+    hfscx_256_update(pre, sb, 4);
+    explicit_bzero(mac_iv, sizeof mac_iv);
+}
+
+static void hkx2_seg_tag(const HfscxCtx *pre, uint64_t idx, int final,
+                         const uint8_t *ct, size_t ct_len, uint8_t tag_out[32])
+{
+    HfscxCtx c = *pre;
+    uint8_t ib[9];
+    int j;
+    for (j = 0; j < 8; j++) ib[j] = (uint8_t)(idx >> (56 - 8 * j));
+    ib[8] = final ? 1 : 0;
+    hfscx_256_update(&c, ib, 9);
+    hfscx_256_update(&c, ct, ct_len);
+    hfscx_256_final(&c, tag_out);
+    explicit_bzero(&c, sizeof c);
+}
+
+/* A run of consecutive HKX2 segments held in one buffer, segment i at
+ * buf + i*stride.  Sealing encrypts in place (stride = seg) and writes the
+ * tags to tags[32*i]; opening expects ct_i | tag_i records (stride =
+ * seg + 32), sets ok[i] and decrypts only the segments that verify.  Every
+ * segment is full except possibly the last (last_len bytes), which carries
+ * final = 1 when it ends the file. */
+typedef struct {
+    const BitArray *seed, *base;
+    const HfscxCtx *pre;
+    uint32_t seg;
+    uint64_t idx0;
+    size_t   cnt, last_len, stride;
+    int      final;
+    uint8_t *buf;
+    uint8_t *tags;   /* seal only */
+    uint8_t *ok;     /* open only */
+} Hkx2Batch;
+
+static void _hkx2_batch_seg(const Hkx2Batch *b, size_t i, ParPool *ks_pool)
+{
+    uint8_t *p = b->buf + i * b->stride, t[32];
+    size_t len = (i + 1 == b->cnt) ? b->last_len : b->seg;
+    uint64_t idx = b->idx0 + i;
+    uint32_t blk = (uint32_t)(idx * (b->seg / KEYBYTES));
+    int fin = b->final && i + 1 == b->cnt;
+    if (b->ok) {
+        hkx2_seg_tag(b->pre, idx, fin, p, len, t);
+        b->ok[i] = (uint8_t)ct_eq32(p + len, t);
+        if (!b->ok[i]) return;
+    }
+    if (ks_pool) hske_nla1_xor_ks_par(ks_pool, b->seed, b->base, blk, p, len, p);
+    else         hske_nla1_xor_ks(b->seed, b->base, blk, p, len, p);
+    if (!b->ok) hkx2_seg_tag(b->pre, idx, fin, p, len, b->tags + 32 * i);
+}
+
+static void _hkx2_batch_job(void *v, int k, int n)
+{
+    const Hkx2Batch *b = (const Hkx2Batch *)v;
+    size_t i;
+    for (i = (size_t)k; i < b->cnt; i += (size_t)n) _hkx2_batch_seg(b, i, NULL);
+}
+
+/* Segments are independent — each tag covers only its own index, flag and
+ * ciphertext — so a batch runs one whole segment (keystream and tag) per
+ * worker.  A batch smaller than the pool splits each segment's keystream
+ * across the pool instead. */
+static void _hkx2_batch_run(ParPool *pool, Hkx2Batch *b)
+{
+    size_t i;
+    if (b->cnt >= (size_t)pool->n) { par_pool_run(pool, _hkx2_batch_job, b); return; }
+    for (i = 0; i < b->cnt; i++) _hkx2_batch_seg(b, i, pool);
+}
+
+static void hkx2_seal_batch(ParPool *pool, Hkx2Batch *b)
 {
-    BitArray base_i = *base;
-    base_i.b[KEYBYTES-4] ^= (uint8_t)((i >> 24) & 0xFF);
-    base_i.b[KEYBYTES-3] ^= (uint8_t)((i >> 16) & 0xFF);
-    base_i.b[KEYBYTES-2] ^= (uint8_t)((i >>  8) & 0xFF);
-    base_i.b[KEYBYTES-1] ^= (uint8_t)( i        & 0xFF);
-    nl_fscx_revolve_v1_ba(ks_out, seed, &base_i, I_VALUE);
+    b->ok = NULL;
+    _hkx2_batch_run(pool, b);
 }
 
-static void hske_nla1_mac_key(const BitArray *seed, const BitArray *base,
-                               BitArray *mac_key_out)
+/* Returns how many leading segments verified; only those may be released. */
+static size_t hkx2_open_batch(ParPool *pool, Hkx2Batch *b)
 {
-    BitArray seed2;
-    ba_rol_k(&seed2, seed, KEYBITS / 4);
-    nl_fscx_revolve_v1_ba(mac_key_out, &seed2, base, I_VALUE);
+    size_t i;
+    _hkx2_batch_run(pool, b);
+    for (i = 0; i < b->cnt && b->ok[i]; i++) ;
+    return i;
 }
 
 /* ─────────────────────────────────────────────────────────────────────────────
@@ -780,35 +2369,27 @@ static void _hske_nl_aead_tag(const BitArray *mac_key, const BitArray *nonce,
                               const uint8_t *ct, size_t ct_len,
                               uint8_t tag_out[32])
 {
-    uint8_t mac_iv[32];
-    size_t len = _AEAD_DS_LEN + KEYBYTES + 8 + ad_len + 8 + ct_len, off;
-    uint8_t *buf = (uint8_t *)malloc(len);
+    uint8_t mac_iv[32], lb[8];
+    HfscxCtx c;
     int j;
-    if (!buf) { fprintf(stderr, "hske_nl_aead: out of memory\n"); exit(1); }
     for (j = 0; j < 32; j++) mac_iv[j] = mac_key->b[j] ^ _HFSCX256_IV[j];
-    memcpy(buf, _AEAD_DS, _AEAD_DS_LEN);
-    off = _AEAD_DS_LEN;
-    memcpy(buf + off, nonce->b, KEYBYTES);          off += KEYBYTES;
-    _hske_nl_aead_be64(buf + off, (uint64_t)ad_len); off += 8;
-    if (ad_len) memcpy(buf + off, ad, ad_len);
-    off += ad_len;
-    _hske_nl_aead_be64(buf + off, (uint64_t)ct_len); off += 8;
-    if (ct_len) memcpy(buf + off, ct, ct_len);
-    hfscx_256(buf, len, mac_iv, tag_out);
-    free(buf);
+    hfscx_256_init(&c, mac_iv);
+    hfscx_256_update(&c, (const uint8_t *)_AEAD_DS, _AEAD_DS_LEN);
+    hfscx_256_update(&c, nonce->b, KEYBYTES);
+    _hske_nl_aead_be64(lb, (uint64_t)ad_len);
+    hfscx_256_update(&c, lb, 8);
+    hfscx_256_update(&c, ad, ad_len);
+    _hske_nl_aead_be64(lb, (uint64_t)ct_len);
+    hfscx_256_update(&c, lb, 8);
+    hfscx_256_update(&c, ct, ct_len);
+    hfscx_256_final(&c, tag_out);
+    explicit_bzero(mac_iv, sizeof mac_iv);
 }
 
 static void _hske_nl_aead_xor_ks(const BitArray *seed, const BitArray *base,
                                  const uint8_t *in, size_t len, uint8_t *out)
 {
-    BitArray ks;
-    size_t off, blk, j;
-    uint32_t i = 0;
-    for (off = 0; off < len; off += KEYBYTES, i++) {
-        blk = (len - off < KEYBYTES) ? len - off : KEYBYTES;
-        hske_nla1_ks_block(seed, base, i, &ks);
-        for (j = 0; j < blk; j++) out[off + j] = in[off + j] ^ ks.b[j];
-    }
+    hske_nla1_xor_ks(seed, base, 0, in, len, out);
 }
 
 /* AEAD-encrypt pt_len bytes into ct_out (same length) and tag_out (32 bytes).
@@ -866,14 +2447,16 @@ static int hske_nl_aead_decrypt(const BitArray *key, const BitArray *nonce,
 #define _V2DPLEX_DS_TWEAK_L 18
 #define _V2DPLEX_DS_TAG_L   16
 
-typedef struct { uint8_t s[KEYBYTES]; BitArray tw; } _V2DState;
+/* tw holds the session tweak and its delta, so each permutation call is
+   I_VALUE fscx+add steps with no multiply. */
+typedef struct { uint8_t s[KEYBYTES]; NlV2Ctx tw; } _V2DState;
 
 static void _v2dplex_perm(_V2DState *d)
 {
-    BitArray sa, out;
+    BitArray sa;
     memcpy(sa.b, d->s, KEYBYTES);
-    nl_fscx_revolve_v2_ba(&out, &sa, &d->tw, I_VALUE);
-    memcpy(d->s, out.b, KEYBYTES);
+    nl_v2_ctx_revolve(&sa, &sa, &d->tw, I_VALUE);
+    memcpy(d->s, sa.b, KEYBYTES);
 }
 
 static void _v2dplex_init(_V2DState *d, const BitArray *key, const BitArray *nonce)
@@ -888,35 +2471,39 @@ static void _v2dplex_init(_V2DState *d, const BitArray *key, const BitArray *non
     memcpy(buf, _V2DPLEX_DS_TWEAK, _V2DPLEX_DS_TWEAK_L);
     memcpy(buf + _V2DPLEX_DS_TWEAK_L, key->b, KEYBYTES);
     memcpy(buf + _V2DPLEX_DS_TWEAK_L + KEYBYTES, nonce->b, KEYBYTES);
-    hfscx_256(buf, (size_t)(_V2DPLEX_DS_TWEAK_L + 2 * KEYBYTES), NULL, d->tw.b);
+    {
+        BitArray tw;
+        hfscx_256(buf, (size_t)(_V2DPLEX_DS_TWEAK_L + 2 * KEYBYTES), NULL, tw.b);
+        nl_v2_ctx_init(&d->tw, &tw);
+    }
     _v2dplex_perm(d);
     _v2dplex_perm(d);
 }
 
+/* XOR bytes into the rate at *pos, permuting each time the rate fills. */
+static void _v2dplex_absorb(_V2DState *d, size_t *pos, const uint8_t *in, size_t len)
+{
+    size_t j;
+    while (len) {
+        size_t take = (size_t)_V2DPLEX_RATE - *pos;
+        if (take > len) take = len;
+        for (j = 0; j < take; j++) d->s[*pos + j] ^= in[j];
+        *pos += take; in += take; len -= take;
+        if (*pos == (size_t)_V2DPLEX_RATE) { _v2dplex_perm(d); *pos = 0; }
+    }
+}
+
+/* Absorb len_be8 || ad || 0x80 || 0* up to a rate boundary, then the end-of-AD
+   separator.  The padding always lands in the block the AD ends in. */
 static void _v2dplex_absorb_ad(_V2DState *d, const uint8_t *ad, size_t ad_len)
 {
-    size_t total, padded_len, off;
-    size_t i;
-    uint8_t *padded;
     uint8_t len_buf[8];
-    size_t orig_ad_len = ad_len;
-
-    _hske_nl_aead_be64(len_buf, (uint64_t)orig_ad_len);
-    total = 8 + orig_ad_len;
-    /* round up to next multiple of rate, always add at least one padding block */
-    padded_len = ((total / _V2DPLEX_RATE) + 1) * _V2DPLEX_RATE;
-    padded = (uint8_t *)malloc(padded_len);
-    if (!padded) { fprintf(stderr, "v2_duplex: out of memory\n"); exit(1); }
-    memset(padded, 0, padded_len);
-    memcpy(padded, len_buf, 8);
-    if (orig_ad_len) memcpy(padded + 8, ad, orig_ad_len);
-    padded[total] = 0x80;   /* padding byte */
-
-    for (off = 0; off < padded_len; off += _V2DPLEX_RATE) {
-        for (i = 0; i < (size_t)_V2DPLEX_RATE; i++) d->s[i] ^= padded[off + i];
-        _v2dplex_perm(d);
-    }
-    free(padded);
+    size_t pos = 0;
+    _hske_nl_aead_be64(len_buf, (uint64_t)ad_len);
+    _v2dplex_absorb(d, &pos, len_buf, 8);
+    _v2dplex_absorb(d, &pos, ad, ad_len);
+    d->s[pos] ^= 0x80;
+    _v2dplex_perm(d);
     d->s[_V2DPLEX_RATE] ^= 0x01;   /* domain separator: end of AD */
     _v2dplex_perm(d);
 }
@@ -931,6 +2518,93 @@ static void _v2dplex_squeeze_tag(_V2DState *d, uint8_t tag[32])
     hfscx_256(buf, KEYBYTES + _V2DPLEX_DS_TAG_L, NULL, tag);
 }
 
+/* Streaming HSKE-NL-V2-Duplex.  Call init, absorb_ad once (even for empty
+ * AD), then encrypt_update or decrypt_update any number of times with any
+ * split, then encrypt_final / decrypt_final.  The state is the 32-byte
+ * sponge, the cached tweak context and the rate position: no heap, and the
+ * output matches the one-shot functions for every split.
+ * decrypt_update releases plaintext before the tag is checked; a caller
+ * that streams must discard everything it produced if decrypt_final fails. */
+typedef struct {
+    _V2DState d;
+    size_t    pos;      /* bytes of the current rate block used */
+    uint64_t  len;      /* message bytes processed */
+} HskeDuplexCtx;
+
+static void hske_nl_v2_duplex_init(HskeDuplexCtx *c, const BitArray *key,
+                                   const BitArray *nonce)
+{
+    _v2dplex_init(&c->d, key, nonce);
+    c->pos = 0;
+    c->len = 0;
+}
+
+static void hske_nl_v2_duplex_absorb_ad(HskeDuplexCtx *c, const uint8_t *ad,
+                                        size_t ad_len)
+{
+    _v2dplex_absorb_ad(&c->d, ad, ad_len);
+}
+
+/* ct = rate ^ pt; the rate then holds ct (= rate ^ pt absorbed). */
+static void hske_nl_v2_duplex_encrypt_update(HskeDuplexCtx *c, const uint8_t *pt,
+                                             size_t len, uint8_t *ct_out)
+{
+    size_t j;
+    c->len += len;
+    while (len) {
+        size_t take = (size_t)_V2DPLEX_RATE - c->pos;
+        uint8_t *r = c->d.s + c->pos;
+        if (take > len) take = len;
+        for (j = 0; j < take; j++) { r[j] ^= pt[j]; ct_out[j] = r[j]; }
+        c->pos += take; pt += take; ct_out += take; len -= take;
+        if (c->pos == (size_t)_V2DPLEX_RATE) { _v2dplex_perm(&c->d); c->pos = 0; }
+    }
+}
+
+/* pt = rate ^ ct; absorbing pt leaves ct in the rate. */
+static void hske_nl_v2_duplex_decrypt_update(HskeDuplexCtx *c, const uint8_t *ct,
+                                             size_t len, uint8_t *pt_out)
+{
+    size_t j;
+    c->len += len;
+    while (len) {
+        size_t take = (size_t)_V2DPLEX_RATE - c->pos;
+        uint8_t *r = c->d.s + c->pos;
+        if (take > len) take = len;
+        for (j = 0; j < take; j++) { uint8_t y = ct[j]; pt_out[j] = r[j] ^ y; r[j] = y; }
+        c->pos += take; ct += take; pt_out += take; len -= take;
+        if (c->pos == (size_t)_V2DPLEX_RATE) { _v2dplex_perm(&c->d); c->pos = 0; }
+    }
+}
+
+static void _v2dplex_finish(HskeDuplexCtx *c, uint8_t tag[32])
+{
+    if (c->pos) {
+        c->d.s[c->pos] ^= 0x80;
+        _v2dplex_perm(&c->d);
+    } else if (!c->len) {
+        _v2dplex_perm(&c->d);
+    }
+    _v2dplex_squeeze_tag(&c->d, tag);
+    explicit_bzero(c, sizeof *c);
+}
+
+static void hske_nl_v2_duplex_encrypt_final(HskeDuplexCtx *c, uint8_t tag_out[32])
+{
+    _v2dplex_finish(c, tag_out);
+}
+
+/* Returns 1 if tag authenticates everything passed to decrypt_update. */
+static int hske_nl_v2_duplex_decrypt_final(HskeDuplexCtx *c, const uint8_t tag[32])
+{
+    uint8_t expected[32];
+    int ok;
+    _v2dplex_finish(c, expected);
+    ok = ct_eq32(tag, expected);
+    explicit_bzero(expected, sizeof expected);
+    return ok;
+}
+
 /* AEAD-encrypt pt_len bytes into ct_out (same length) and tag_out (32 bytes).
  * Caller supplies a fresh random 256-bit nonce (e.g. via ba_rand). */
 static void hske_nl_v2_duplex_encrypt(
@@ -939,56 +2613,28 @@ static void hske_nl_v2_duplex_encrypt(
     const uint8_t *pt, size_t pt_len,
     uint8_t *ct_out, uint8_t tag_out[32])
 {
-    _V2DState d;
-    size_t off, blk, j;
-    _v2dplex_init(&d, key, nonce);
-    _v2dplex_absorb_ad(&d, ad, ad_len);
-    if (!pt_len) {
-        _v2dplex_perm(&d);
-    } else {
-        for (off = 0; off < pt_len; off += _V2DPLEX_RATE) {
-            blk = (pt_len - off < (size_t)_V2DPLEX_RATE) ? pt_len - off : _V2DPLEX_RATE;
-            for (j = 0; j < blk; j++) ct_out[off + j] = d.s[j] ^ pt[off + j];
-            for (j = 0; j < blk; j++) d.s[j] ^= pt[off + j];
-            if (blk < (size_t)_V2DPLEX_RATE) d.s[blk] ^= 0x80;
-            _v2dplex_perm(&d);
-        }
-    }
-    _v2dplex_squeeze_tag(&d, tag_out);
+    HskeDuplexCtx c;
+    hske_nl_v2_duplex_init(&c, key, nonce);
+    hske_nl_v2_duplex_absorb_ad(&c, ad, ad_len);
+    hske_nl_v2_duplex_encrypt_update(&c, pt, pt_len, ct_out);
+    hske_nl_v2_duplex_encrypt_final(&c, tag_out);
 }
 
-/* Verify-then-decrypt.  Returns 1 on success, 0 on auth failure (pt_out untouched). */
+/* Decrypt, then verify.  Returns 1 on success; on auth failure returns 0
+ * and pt_out is zeroed, so no unauthenticated plaintext survives. */
 static int hske_nl_v2_duplex_decrypt(
     const BitArray *key, const BitArray *nonce,
     const uint8_t *ad, size_t ad_len,
     const uint8_t *ct, size_t ct_len,
     const uint8_t tag[32], uint8_t *pt_out)
 {
-    _V2DState d;
-    uint8_t expected[32];
-    uint8_t *tmp;
-    size_t off, blk, j;
-
-    _v2dplex_init(&d, key, nonce);
-    _v2dplex_absorb_ad(&d, ad, ad_len);
-    tmp = ct_len ? (uint8_t *)malloc(ct_len) : NULL;
-    if (ct_len && !tmp) { fprintf(stderr, "v2_duplex: out of memory\n"); exit(1); }
-
-    if (!ct_len) {
-        _v2dplex_perm(&d);
-    } else {
-        for (off = 0; off < ct_len; off += _V2DPLEX_RATE) {
-            blk = (ct_len - off < (size_t)_V2DPLEX_RATE) ? ct_len - off : _V2DPLEX_RATE;
-            for (j = 0; j < blk; j++) tmp[off + j] = d.s[j] ^ ct[off + j];  /* pt */
-            for (j = 0; j < blk; j++) d.s[j] ^= tmp[off + j];               /* absorb pt */
-            if (blk < (size_t)_V2DPLEX_RATE) d.s[blk] ^= 0x80;
-            _v2dplex_perm(&d);
-        }
-    }
-    _v2dplex_squeeze_tag(&d, expected);
-    if (!ct_eq32(tag, expected)) { free(tmp); return 0; }
-    if (tmp) { memcpy(pt_out, tmp, ct_len); free(tmp); }
-    return 1;
+    HskeDuplexCtx c;
+    hske_nl_v2_duplex_init(&c, key, nonce);
+    hske_nl_v2_duplex_absorb_ad(&c, ad, ad_len);
+    hske_nl_v2_duplex_decrypt_update(&c, ct, ct_len, pt_out);
+    if (hske_nl_v2_duplex_decrypt_final(&c, tag)) return 1;
+    if (ct_len) explicit_bzero(pt_out, ct_len);
+    return 0;
 }
 
 /* ─────────────────────────────────────────────────────────────────────────────
@@ -1032,16 +2678,15 @@ static void _drbg_be64(uint8_t *dst, uint64_t v)
 static void drbg_seed(HDrbg *d, const uint8_t *entropy, size_t entropy_len,
                       const uint8_t *pers, size_t pers_len)
 {
-    size_t len = 9 + 8 + entropy_len + pers_len;
-    uint8_t *buf = (uint8_t *)malloc(len);
-    if (!buf) { fprintf(stderr, "drbg_seed: out of memory\n"); exit(1); }
-    memcpy(buf, "DRBG-INIT", 9);
-    _drbg_be64(buf + 9, (uint64_t)entropy_len);
-    if (entropy_len) memcpy(buf + 17, entropy, entropy_len);
-    if (pers_len) memcpy(buf + 17 + entropy_len, pers, pers_len);
-    hfscx_256(buf, len, NULL, d->state.b);
-    explicit_bzero(buf, len);
-    free(buf);
+    uint8_t lb[8];
+    HfscxCtx c;
+    hfscx_256_init(&c, NULL);
+    hfscx_256_update(&c, (const uint8_t *)"DRBG-INIT", 9);
+    _drbg_be64(lb, (uint64_t)entropy_len);
+    hfscx_256_update(&c, lb, 8);
+    hfscx_256_update(&c, entropy, entropy_len);
+    hfscx_256_update(&c, pers, pers_len);
+    hfscx_256_final(&c, d->state.b);     /* final() erases the context */
     d->blocks = 0;
 }
 
@@ -1077,19 +2722,95 @@ static int drbg_generate(HDrbg *d, uint8_t *out, size_t n_bytes)
 /* Mix fresh entropy into the state and reset the output-block counter. */
 static void drbg_reseed(HDrbg *d, const uint8_t *entropy, size_t entropy_len)
 {
-    size_t len = 11 + KEYBYTES + 8 + entropy_len;
-    uint8_t *buf = (uint8_t *)malloc(len);
-    if (!buf) { fprintf(stderr, "drbg_reseed: out of memory\n"); exit(1); }
-    memcpy(buf, "DRBG-RESEED", 11);
-    memcpy(buf + 11, d->state.b, KEYBYTES);
-    _drbg_be64(buf + 11 + KEYBYTES, (uint64_t)entropy_len);
-    if (entropy_len) memcpy(buf + 11 + KEYBYTES + 8, entropy, entropy_len);
-    hfscx_256(buf, len, NULL, d->state.b);
-    explicit_bzero(buf, len);
-    free(buf);
+    uint8_t lb[8];
+    HfscxCtx c;
+    hfscx_256_init(&c, NULL);
+    hfscx_256_update(&c, (const uint8_t *)"DRBG-RESEED", 11);
+    hfscx_256_update(&c, d->state.b, KEYBYTES);
+    _drbg_be64(lb, (uint64_t)entropy_len);
+    hfscx_256_update(&c, lb, 8);
+    hfscx_256_update(&c, entropy, entropy_len);
+    hfscx_256_final(&c, d->state.b);
     d->blocks = 0;
 }
 
+/* Bulk mode: one ratchet per request rather than per block (the request
+ * structure of SP 800-90A Hash_DRBG / CTR_DRBG).
+ *   key_r  = HFSCX-256(state || blocks_be8 || "DRBG-REQ")
+ *   output = HSKE-NL-A1 CTR keystream under base = key_r, blocks 0..m-1
+ *   state  = nl_fscx_revolve_v1(state, DRBG_DOMAIN, n/4), old state erased
+ * so the keystream runs on the multi-lane kernel.  Forward secrecy holds at
+ * request boundaries: key_r and the superseded state are erased before
+ * returning.  A different stream from drbg_generate for the same state; the
+ * two modes share the block budget.  Returns 0 (no output) past
+ * DRBG_MAX_BLOCKS. */
+static int drbg_generate_bulk(HDrbg *d, uint8_t *out, size_t n_bytes)
+{
+    BitArray dom, key, seed, next;
+    uint8_t lb[8];
+    HfscxCtx c;
+    uint64_t n_blocks = (n_bytes + KEYBYTES - 1) / KEYBYTES;
+
+    if (d->blocks + n_blocks > DRBG_MAX_BLOCKS) return 0;
+    hfscx_256_init(&c, NULL);
+    hfscx_256_update(&c, d->state.b, KEYBYTES);
+    _drbg_be64(lb, d->blocks);
+    hfscx_256_update(&c, lb, 8);
+    hfscx_256_update(&c, (const uint8_t *)"DRBG-REQ", 8);
+    hfscx_256_final(&c, key.b);
+    ba_rnl_kdf_seed(&seed, &key);
+    memset(out, 0, n_bytes);
+    hske_nla1_xor_ks(&seed, &key, 0, out, n_bytes, out);
+
+    memcpy(dom.b, _DRBG_DOMAIN_BYTES, KEYBYTES);
+    nl_fscx_revolve_v1_ba(&next, &d->state, &dom, I_VALUE);
+    explicit_bzero(d->state.b, KEYBYTES);
+    d->state = next;
+    d->blocks += n_blocks;
+    explicit_bzero(&key, sizeof key);
+    explicit_bzero(&seed, sizeof seed);
+    explicit_bzero(&next, sizeof next);
+    return 1;
+}
+
+/* Buffered bulk HDRBG.  Small reads are served from a batch refilled by one
+ * drbg_generate_bulk request; reads of at least HDRBG_BUF_BYTES skip the
+ * buffer and become one request of their own.  Consumed bytes are erased at
+ * once, so only the unread tail of the current batch is exposed by a later
+ * state compromise. */
+#define HDRBG_BUF_BYTES 4096
+
+typedef struct {
+    HDrbg   d;
+    uint8_t buf[HDRBG_BUF_BYTES];
+    size_t  pos;        /* next unread byte; HDRBG_BUF_BYTES when empty */
+} HDrbgBuf;
+
+static void drbg_buf_init(HDrbgBuf *b, const HDrbg *d)
+{
+    b->d = *d;
+    b->pos = HDRBG_BUF_BYTES;
+}
+
+/* Returns 1, or 0 if the block budget is exhausted (reseed b->d). */
+static int drbg_buf_read(HDrbgBuf *b, uint8_t *out, size_t n)
+{
+    size_t take;
+    if (n >= HDRBG_BUF_BYTES) return drbg_generate_bulk(&b->d, out, n);
+    while (n) {
+        if (b->pos == HDRBG_BUF_BYTES) {
+            if (!drbg_generate_bulk(&b->d, b->buf, HDRBG_BUF_BYTES)) return 0;
+            b->pos = 0;
+        }
+        take = HDRBG_BUF_BYTES - b->pos;
+        if (take > n) take = n;
+        memcpy(out, b->buf + b->pos, take);
+        explicit_bzero(b->buf + b->pos, take);
+        b->pos += take; out += take; n -= take;
+    }
+    return 1;
+}
+
 /* ─────────────────────────────────────────────────────────────────────────────
  * HKEX-RNL: Ring-LWR key exchange helpers (n=256, negacyclic Z_q[x]/(x^n+1))
  * ───────────────────────────────────────────────────────────────────────────── */
@@ -1122,54 +2843,384 @@ static uint32_t rnl_mod_pow(uint32_t base, uint32_t exp, uint32_t m)
 /* Precomputed NTT twiddle tables for n=RNL_N, q=RNL_Q (lazy-initialized on first use). */
 #define RNL_LOG2N 10  /* log2(1024) — must track RNL_N */
 static struct {
-    uint32_t psi_pow[RNL_N];          /* ψ^i for pre-twist */
-    uint32_t psi_inv_pow[RNL_N];      /* ψ^{-i} for post-twist */
-    uint32_t stage_w_fwd[RNL_LOG2N];  /* per-stage ω, forward NTT */
-    uint32_t stage_w_inv[RNL_LOG2N];  /* per-stage ω, inverse NTT */
+    int32_t  zeta[RNL_N];             /* ψ^brv10(k): merged-twist CT forward, k = 1..n-1 */
+    int32_t  zeta_inv[RNL_N];         /* ψ^-brv10(k): merged-twist GS inverse */
+    uint32_t stage_w_fwd[RNL_LOG2N];  /* per-stage ω, cyclic rnl_ntt_ex */
+    uint32_t stage_w_inv[RNL_LOG2N];
     uint32_t inv_n;                   /* n^{-1} mod q for INTT scaling */
 } rnl_tw;
 
-/* Secondary twiddle table for HCRED's ring, which stays at 256 while HKEX-RNL's
-   moved to 1024 (TODO #223).  Only psi/psi_inv/inv_n are dimension-dependent:
-   the per-stage roots are 3^((q-1)/length), a function of `length` alone, so the
-   RNL_N stage tables are correct for every smaller power of two as well. */
+/* Secondary table for HCRED's ring, which stays at 256 while HKEX-RNL's moved
+   to 1024 (TODO #223).  Only inv_n is dimension-dependent: the per-stage roots
+   are 3^((q-1)/length), a function of `length` alone, and ψ_256 = ψ_1024^4 with
+   brv10(k) = 4·brv8(k) for k < 256, so zeta[1..255] is already the n=256
+   table. */
 #define RNL_ALT_N 256   /* == HCRED_N, checked by a static assert at its definition */
 static struct {
-    uint32_t psi_pow[RNL_ALT_N];
-    uint32_t psi_inv_pow[RNL_ALT_N];
     uint32_t inv_n;
 } rnl_tw_alt;
 
+/* Lazy Fermat reduction: x = H·2^32 + M·2^16 + L ≡ L − M + H (mod 2^16+1),
+   no division.  The result is congruent, not canonical: |r| < 2^16 + |x|/2^32,
+   so any product below 2^44 in magnitude comes back below 2^17. */
+static inline int32_t rnl_fermat_red(int64_t x)
+{
+    return (int32_t)(x & 0xFFFF) - (int32_t)((x >> 16) & 0xFFFF) + (int32_t)(x >> 32);
+}
+
+/* Negacyclic NTT over Z_q[x]/(x^n+1), ψ-twist merged into the twiddles
+   (zeta[k] = ψ^brv(k)), natural order in, bit-reversed order out.  Coefficients
+   stay signed and unreduced: each Cooley-Tukey stage adds one |t| < 2^16+2^5,
+   so after log2(1024) = 10 stages |a| < 2^20 — no `% q` anywhere. */
+static void rnl_nwt_fwd(int32_t *a, int n)
+{
+    int len, start, j, k = 1;
+    for (len = n >> 1; len >= 1; len >>= 1) {
+        for (start = 0; start < n; start += 2 * len) {
+            const int64_t z = rnl_tw.zeta[k++];
+            for (j = start; j < start + len; j++) {
+                int32_t t = rnl_fermat_red(z * a[j + len]);
+                a[j + len] = a[j] - t;
+                a[j]       = a[j] + t;
+            }
+        }
+    }
+}
+
+/* Inverse of rnl_nwt_fwd (Gentleman-Sande, bit-reversed in, natural out),
+   without the n^{-1} scaling.  The sums double per stage: inputs below 2^17
+   end below 2^27, well inside int32. */
+static void rnl_nwt_inv(int32_t *a, int n)
+{
+    int len, start, j, m;
+    for (len = 1, m = n >> 1; len < n; len <<= 1, m >>= 1) {
+        for (start = 0; start < n; start += 2 * len) {
+            const int64_t z = rnl_tw.zeta_inv[m + start / (2 * len)];
+            for (j = start; j < start + len; j++) {
+                int32_t u = a[j], v = a[j + len];
+                a[j]       = u + v;
+                a[j + len] = rnl_fermat_red(z * (u - v));
+            }
+        }
+    }
+}
+
+/* Canonical residue in [0, q) of any int32: one more fold lands in
+   [-2^16, 2^16), one masked add finishes it. */
+static inline int32_t rnl_canon(int32_t r)
+{
+    r = rnl_fermat_red(r);
+    return r + (RNL_Q & (r >> 31));
+}
+
+/* Portable reference backend for rnl_poly_mul_dim.  Inputs are read as uint32
+   mod q, exactly as the original twist/NTT/untwist pipeline did, and the output
+   is canonical, so results are bit-identical to it; the only reductions are the
+   lazy one per multiply and one canonicalisation per output coefficient. */
+static void _rnl_poly_mul_soft(int32_t *h, const int32_t *f, const int32_t *g,
+                               int n, uint32_t inv_n)
+{
+    int32_t fa[RNL_N], ga[RNL_N];   /* RNL_N is the larger of the two dimensions */
+    int i;
+    for (i = 0; i < n; i++) {
+        /* uint32 v = hi·2^16 + lo ≡ lo − hi: |.| < 2^16 */
+        uint32_t vf = (uint32_t)f[i], vg = (uint32_t)g[i];
+        fa[i] = (int32_t)(vf & 0xFFFF) - (int32_t)(vf >> 16);
+        ga[i] = (int32_t)(vg & 0xFFFF) - (int32_t)(vg >> 16);
+    }
+    rnl_nwt_fwd(fa, n);
+    rnl_nwt_fwd(ga, n);
+    for (i = 0; i < n; i++)
+        fa[i] = rnl_fermat_red((int64_t)fa[i] * ga[i]);
+    rnl_nwt_inv(fa, n);
+    for (i = 0; i < n; i++)
+        h[i] = rnl_canon(rnl_fermat_red((int64_t)inv_n * fa[i]));
+}
+
+/* round_p(x) = ⌊(x·p + q/2) / q⌋ mod p and lift_q(x) = ⌊(x·q + p/2) / p⌋ mod q at
+   the protocol's (q, p); rnl_round_dim / rnl_lift_dim keep the general form. */
+static inline int32_t _rnl_round_qp_1(int32_t x)
+{
+    return (int32_t)(((int64_t)x * RNL_P + RNL_Q / 2) / RNL_Q % RNL_P);
+}
+
+static inline int32_t _rnl_lift_pq_1(int32_t x)
+{
+    return (int32_t)(((int64_t)x * RNL_Q + RNL_P / 2) / RNL_P % RNL_Q);
+}
+
+static void _rnl_round_qp_soft(int32_t *out, const int32_t *in, int n)
+{
+    int i;
+    for (i = 0; i < n; i++) out[i] = _rnl_round_qp_1(in[i]);
+}
+
+static void _rnl_lift_pq_soft(int32_t *out, const int32_t *in, int n)
+{
+    int i;
+    for (i = 0; i < n; i++) out[i] = _rnl_lift_pq_1(in[i]);
+}
+
+#ifdef HERRADURA_HAVE_AVX2
+/* rnl_fermat_red((int64)a·b) on eight int32 lanes: even and odd lanes go
+   through 32×32→64 multiplies, and L − M + H is formed in the low dword of
+   each 64-bit product, so every lane equals the scalar result exactly. */
+__attribute__((target("avx2")))
+static inline __m256i _rnl_red_mul8(__m256i a, __m256i b)
+{
+    const __m256i lo16 = _mm256_set1_epi32(0xFFFF);
+    __m256i pe = _mm256_mul_epi32(a, b);
+    __m256i po = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+    __m256i re = _mm256_add_epi32(_mm256_sub_epi32(_mm256_and_si256(pe, lo16),
+                                                   _mm256_srli_epi32(pe, 16)),
+                                  _mm256_srli_epi64(pe, 32));
+    __m256i ro = _mm256_add_epi32(_mm256_sub_epi32(_mm256_and_si256(po, lo16),
+                                                   _mm256_srli_epi32(po, 16)),
+                                  _mm256_srli_epi64(po, 32));
+    return _mm256_blend_epi32(re, _mm256_slli_epi64(ro, 32), 0xAA);
+}
+
+/* Zeta vectors for the three in-register stages of a 16-coefficient group:
+   lane order follows the shuffles in _rnl_nwt_tail_avx2 / _rnl_nwt_head_avx2. */
+__attribute__((target("avx2")))
+static inline void _rnl_zeta3(const int32_t *zt, int n, int grp, __m256i z[3])
+{
+    z[0] = _mm256_permutevar8x32_epi32(
+               _mm256_castsi128_si256(_mm_loadl_epi64((const __m128i *)(zt + n / 8 + 2 * grp))),
+               _mm256_setr_epi32(0, 0, 0, 0, 1, 1, 1, 1));
+    z[1] = _mm256_permutevar8x32_epi32(
+               _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)(zt + n / 4 + 4 * grp))),
+               _mm256_setr_epi32(0, 0, 2, 2, 1, 1, 3, 3));
+    z[2] = _mm256_permutevar8x32_epi32(
+               _mm256_loadu_si256((const __m256i *)(zt + n / 2 + 8 * grp)),
+               _mm256_setr_epi32(0, 1, 4, 5, 2, 3, 6, 7));
+}
+
+/* Forward stages len = 4, 2, 1 on one 16-coefficient group held in A, B. */
+__attribute__((target("avx2")))
+static inline void _rnl_nwt_tail_avx2(__m256i *A, __m256i *B, const __m256i z[3])
+{
+    __m256i X, Y, t;
+    X = _mm256_permute2x128_si256(*A, *B, 0x20);
+    Y = _mm256_permute2x128_si256(*A, *B, 0x31);
+    t = _rnl_red_mul8(Y, z[0]); Y = _mm256_sub_epi32(X, t); X = _mm256_add_epi32(X, t);
+    *A = _mm256_permute2x128_si256(X, Y, 0x20);
+    *B = _mm256_permute2x128_si256(X, Y, 0x31);
+
+    X = _mm256_unpacklo_epi64(*A, *B);
+    Y = _mm256_unpackhi_epi64(*A, *B);
+    t = _rnl_red_mul8(Y, z[1]); Y = _mm256_sub_epi32(X, t); X = _mm256_add_epi32(X, t);
+    *A = _mm256_unpacklo_epi64(X, Y);
+    *B = _mm256_unpackhi_epi64(X, Y);
+
+    *A = _mm256_shuffle_epi32(*A, 0xD8);
+    *B = _mm256_shuffle_epi32(*B, 0xD8);
+    X = _mm256_unpacklo_epi64(*A, *B);
+    Y = _mm256_unpackhi_epi64(*A, *B);
+    t = _rnl_red_mul8(Y, z[2]); Y = _mm256_sub_epi32(X, t); X = _mm256_add_epi32(X, t);
+    *A = _mm256_shuffle_epi32(_mm256_unpacklo_epi64(X, Y), 0xD8);
+    *B = _mm256_shuffle_epi32(_mm256_unpackhi_epi64(X, Y), 0xD8);
+}
+
+/* Inverse stages len = 1, 2, 4: the same shuffles run backwards. */
+__attribute__((target("avx2")))
+static inline void _rnl_nwt_head_avx2(__m256i *A, __m256i *B, const __m256i z[3])
+{
+    __m256i X, Y, d;
+    *A = _mm256_shuffle_epi32(*A, 0xD8);
+    *B = _mm256_shuffle_epi32(*B, 0xD8);
+    X = _mm256_unpacklo_epi64(*A, *B);
+    Y = _mm256_unpackhi_epi64(*A, *B);
+    d = _mm256_sub_epi32(X, Y); X = _mm256_add_epi32(X, Y); Y = _rnl_red_mul8(d, z[2]);
+    *A = _mm256_shuffle_epi32(_mm256_unpacklo_epi64(X, Y), 0xD8);
+    *B = _mm256_shuffle_epi32(_mm256_unpackhi_epi64(X, Y), 0xD8);
+
+    X = _mm256_unpacklo_epi64(*A, *B);
+    Y = _mm256_unpackhi_epi64(*A, *B);
+    d = _mm256_sub_epi32(X, Y); X = _mm256_add_epi32(X, Y); Y = _rnl_red_mul8(d, z[1]);
+    *A = _mm256_unpacklo_epi64(X, Y);
+    *B = _mm256_unpackhi_epi64(X, Y);
+
+    X = _mm256_permute2x128_si256(*A, *B, 0x20);
+    Y = _mm256_permute2x128_si256(*A, *B, 0x31);
+    d = _mm256_sub_epi32(X, Y); X = _mm256_add_epi32(X, Y); Y = _rnl_red_mul8(d, z[0]);
+    *A = _mm256_permute2x128_si256(X, Y, 0x20);
+    *B = _mm256_permute2x128_si256(X, Y, 0x31);
+}
+
+/* rnl_nwt_fwd on eight lanes: broadcast-zeta stages while len >= 8, then the
+   last three stages per 16-coefficient group without leaving registers. */
+__attribute__((target("avx2")))
+static void _rnl_nwt_fwd_avx2(int32_t *a, int n)
+{
+    int len, start, j, grp, k = 1;
+    for (len = n >> 1; len >= 8; len >>= 1) {
+        for (start = 0; start < n; start += 2 * len) {
+            const __m256i z = _mm256_set1_epi32(rnl_tw.zeta[k++]);
+            for (j = start; j < start + len; j += 8) {
+                __m256i x = _mm256_loadu_si256((const __m256i *)(a + j));
+                __m256i t = _rnl_red_mul8(_mm256_loadu_si256((const __m256i *)(a + j + len)), z);
+                _mm256_storeu_si256((__m256i *)(a + j + len), _mm256_sub_epi32(x, t));
+                _mm256_storeu_si256((__m256i *)(a + j),       _mm256_add_epi32(x, t));
+            }
+        }
+    }
+    for (grp = 0; grp < n / 16; grp++) {
+        __m256i z[3];
+        __m256i A = _mm256_loadu_si256((const __m256i *)(a + 16 * grp));
+        __m256i B = _mm256_loadu_si256((const __m256i *)(a + 16 * grp + 8));
+        _rnl_zeta3(rnl_tw.zeta, n, grp, z);
+        _rnl_nwt_tail_avx2(&A, &B, z);
+        _mm256_storeu_si256((__m256i *)(a + 16 * grp),     A);
+        _mm256_storeu_si256((__m256i *)(a + 16 * grp + 8), B);
+    }
+}
+
+__attribute__((target("avx2")))
+static void _rnl_nwt_inv_avx2(int32_t *a, int n)
+{
+    int len, start, j, grp, m;
+    for (grp = 0; grp < n / 16; grp++) {
+        __m256i z[3];
+        __m256i A = _mm256_loadu_si256((const __m256i *)(a + 16 * grp));
+        __m256i B = _mm256_loadu_si256((const __m256i *)(a + 16 * grp + 8));
+        _rnl_zeta3(rnl_tw.zeta_inv, n, grp, z);
+        _rnl_nwt_head_avx2(&A, &B, z);
+        _mm256_storeu_si256((__m256i *)(a + 16 * grp),     A);
+        _mm256_storeu_si256((__m256i *)(a + 16 * grp + 8), B);
+    }
+    for (len = 8, m = n >> 4; len < n; len <<= 1, m >>= 1) {
+        for (start = 0; start < n; start += 2 * len) {
+            const __m256i z = _mm256_set1_epi32(rnl_tw.zeta_inv[m + start / (2 * len)]);
+            for (j = start; j < start + len; j += 8) {
+                __m256i u = _mm256_loadu_si256((const __m256i *)(a + j));
+                __m256i v = _mm256_loadu_si256((const __m256i *)(a + j + len));
+                _mm256_storeu_si256((__m256i *)(a + j), _mm256_add_epi32(u, v));
+                _mm256_storeu_si256((__m256i *)(a + j + len),
+                                    _rnl_red_mul8(_mm256_sub_epi32(u, v), z));
+            }
+        }
+    }
+}
+
+/* _rnl_poly_mul_soft on eight lanes; n is a multiple of 16. */
+__attribute__((target("avx2")))
+static void _rnl_poly_mul_avx2(int32_t *h, const int32_t *f, const int32_t *g,
+                               int n, uint32_t inv_n)
+{
+    int32_t fa[RNL_N], ga[RNL_N];
+    const __m256i lo16 = _mm256_set1_epi32(0xFFFF), q = _mm256_set1_epi32(RNL_Q);
+    const __m256i vn = _mm256_set1_epi32((int32_t)inv_n);
+    int i;
+    for (i = 0; i < n; i += 8) {
+        __m256i vf = _mm256_loadu_si256((const __m256i *)(f + i));
+        __m256i vg = _mm256_loadu_si256((const __m256i *)(g + i));
+        _mm256_storeu_si256((__m256i *)(fa + i),
+                            _mm256_sub_epi32(_mm256_and_si256(vf, lo16), _mm256_srli_epi32(vf, 16)));
+        _mm256_storeu_si256((__m256i *)(ga + i),
+                            _mm256_sub_epi32(_mm256_and_si256(vg, lo16), _mm256_srli_epi32(vg, 16)));
+    }
+    _rnl_nwt_fwd_avx2(fa, n);
+    _rnl_nwt_fwd_avx2(ga, n);
+    for (i = 0; i < n; i += 8)
+        _mm256_storeu_si256((__m256i *)(fa + i),
+                            _rnl_red_mul8(_mm256_loadu_si256((const __m256i *)(fa + i)),
+                                          _mm256_loadu_si256((const __m256i *)(ga + i))));
+    _rnl_nwt_inv_avx2(fa, n);
+    for (i = 0; i < n; i += 8) {
+        __m256i r = _rnl_red_mul8(_mm256_loadu_si256((const __m256i *)(fa + i)), vn);
+        r = _mm256_add_epi32(_mm256_sub_epi32(_mm256_and_si256(r, lo16), _mm256_srli_epi32(r, 16)),
+                             _mm256_srai_epi32(r, 31));
+        r = _mm256_add_epi32(r, _mm256_and_si256(q, _mm256_srai_epi32(r, 31)));
+        _mm256_storeu_si256((__m256i *)(h + i), r);
+    }
+}
+
+/* Eight-lane round_p / lift_q with no division.  Only inputs in [0, lim) are
+   vectorised (there every intermediate fits int32); a block holding anything
+   else, and the tail, take the scalar formula. */
+__attribute__((target("avx2")))
+static inline int _rnl_in_range8(__m256i v, int32_t lim)
+{
+    __m256i c = _mm256_min_epu32(v, _mm256_set1_epi32(lim - 1));
+    return _mm256_movemask_epi8(_mm256_cmpeq_epi32(c, v)) == -1;
+}
+
+/* x = in·p + q/2 < 2^31;  x = t·2^16 + L = t·q + (L − t), so ⌊x/q⌋ = t − [L < t]. */
+__attribute__((target("avx2")))
+static void _rnl_round_qp_avx2(int32_t *out, const int32_t *in, int n)
+{
+    const __m256i lo16 = _mm256_set1_epi32(0xFFFF), half = _mm256_set1_epi32(RNL_Q / 2);
+    const __m256i pm = _mm256_set1_epi32(RNL_P - 1);
+    int i = 0, j;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(in + i)), x, t;
+        if (!_rnl_in_range8(v, 1 << 19)) {
+            for (j = i; j < i + 8; j++) out[j] = _rnl_round_qp_1(in[j]);
+            continue;
+        }
+        x = _mm256_add_epi32(_mm256_slli_epi32(v, 12), half);
+        t = _mm256_srli_epi32(x, 16);
+        t = _mm256_add_epi32(t, _mm256_cmpgt_epi32(t, _mm256_and_si256(x, lo16)));
+        _mm256_storeu_si256((__m256i *)(out + i), _mm256_and_si256(t, pm));
+    }
+    for (; i < n; i++) out[i] = _rnl_round_qp_1(in[i]);
+}
+
+/* t = ⌊(in·q + p/2) / p⌋ = (in·2^16 + in + p/2) >> 12 < 2^19;  t mod q = L − H (+q). */
+__attribute__((target("avx2")))
+static void _rnl_lift_pq_avx2(int32_t *out, const int32_t *in, int n)
+{
+    const __m256i lo16 = _mm256_set1_epi32(0xFFFF), half = _mm256_set1_epi32(RNL_P / 2);
+    const __m256i q = _mm256_set1_epi32(RNL_Q);
+    int i = 0, j;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(in + i)), t, r;
+        if (!_rnl_in_range8(v, 1 << 14)) {
+            for (j = i; j < i + 8; j++) out[j] = _rnl_lift_pq_1(in[j]);
+            continue;
+        }
+        t = _mm256_srli_epi32(_mm256_add_epi32(_mm256_add_epi32(_mm256_slli_epi32(v, 16), v), half), 12);
+        r = _mm256_sub_epi32(_mm256_and_si256(t, lo16), _mm256_srli_epi32(t, 16));
+        r = _mm256_add_epi32(r, _mm256_and_si256(q, _mm256_srai_epi32(r, 31)));
+        _mm256_storeu_si256((__m256i *)(out + i), r);
+    }
+    for (; i < n; i++) out[i] = _rnl_lift_pq_1(in[i]);
+}
+#endif
+
+static void (*_rnl_poly_mul_kern)(int32_t *, const int32_t *, const int32_t *, int, uint32_t) =
+    _rnl_poly_mul_soft;
+static void (*_rnl_round_qp)(int32_t *, const int32_t *, int) = _rnl_round_qp_soft;
+static void (*_rnl_lift_pq)(int32_t *, const int32_t *, int)  = _rnl_lift_pq_soft;
+
 static void rnl_twiddle_do_init(void)
 {
-    uint32_t psi, psi_inv, pw, pw_inv, w;
-    int i, s, length;
+    uint32_t psi, psi_inv, w;
+    int k, s, length;
     psi     = rnl_mod_pow(3, (RNL_Q - 1) / (2 * RNL_N), RNL_Q);
     psi_inv = rnl_mod_pow(psi, RNL_Q - 2, RNL_Q);
-    pw = pw_inv = 1;
-    for (i = 0; i < RNL_N; i++) {
-        rnl_tw.psi_pow[i]     = pw;
-        rnl_tw.psi_inv_pow[i] = pw_inv;
-        pw     = (uint32_t)((uint64_t)pw     * psi     % RNL_Q);
-        pw_inv = (uint32_t)((uint64_t)pw_inv * psi_inv % RNL_Q);
+    for (k = 0; k < RNL_N; k++) {
+        uint32_t r = 0;
+        int b;
+        for (b = 0; b < RNL_LOG2N; b++) r |= (uint32_t)((k >> b) & 1) << (RNL_LOG2N - 1 - b);
+        rnl_tw.zeta[k]     = (int32_t)rnl_mod_pow(psi,     r, RNL_Q);
+        rnl_tw.zeta_inv[k] = (int32_t)rnl_mod_pow(psi_inv, r, RNL_Q);
     }
     for (s = 0, length = 2; length <= RNL_N; length <<= 1, s++) {
         w = rnl_mod_pow(3, (RNL_Q - 1) / (uint32_t)length, RNL_Q);
         rnl_tw.stage_w_fwd[s] = w;
         rnl_tw.stage_w_inv[s] = rnl_mod_pow(w, RNL_Q - 2, RNL_Q);
     }
-    rnl_tw.inv_n = rnl_mod_pow((uint32_t)RNL_N, RNL_Q - 2, RNL_Q);
-
-    psi     = rnl_mod_pow(3, (RNL_Q - 1) / (2 * RNL_ALT_N), RNL_Q);
-    psi_inv = rnl_mod_pow(psi, RNL_Q - 2, RNL_Q);
-    pw = pw_inv = 1;
-    for (i = 0; i < RNL_ALT_N; i++) {
-        rnl_tw_alt.psi_pow[i]     = pw;
-        rnl_tw_alt.psi_inv_pow[i] = pw_inv;
-        pw     = (uint32_t)((uint64_t)pw     * psi     % RNL_Q);
-        pw_inv = (uint32_t)((uint64_t)pw_inv * psi_inv % RNL_Q);
-    }
+    rnl_tw.inv_n     = rnl_mod_pow((uint32_t)RNL_N,     RNL_Q - 2, RNL_Q);
     rnl_tw_alt.inv_n = rnl_mod_pow((uint32_t)RNL_ALT_N, RNL_Q - 2, RNL_Q);
+#ifdef HERRADURA_HAVE_AVX2
+    if (__builtin_cpu_supports("avx2")) {
+        _rnl_poly_mul_kern = _rnl_poly_mul_avx2;
+        _rnl_round_qp      = _rnl_round_qp_avx2;
+        _rnl_lift_pq       = _rnl_lift_pq_avx2;
+    }
+#endif
 }
 
 #ifdef _POSIX_THREADS
@@ -1207,6 +3258,8 @@ static inline uint32_t rnl_mulmodq(uint32_t a, uint32_t b)
 }
 
 /* Cooley-Tukey iterative NTT over Z_q (in-place). n must be a power of 2.
+   Cyclic, canonical in and out; rnl_poly_mul_dim uses the negacyclic
+   rnl_nwt_fwd/rnl_nwt_inv below instead.
    Uses primitive root 3 (valid since q=65537 is a Fermat prime, ord(3)=q-1=2^16). */
 /* inv_n is passed in rather than read from rnl_tw because the table is
    dimension-specific: HCRED runs this at 256 while HKEX-RNL runs it at RNL_N. */
@@ -1249,42 +3302,22 @@ static void rnl_ntt(int32_t *a, int n, int q, int invert)
     rnl_ntt_ex(a, n, q, invert, rnl_tw.inv_n);
 }
 
-/* Negacyclic multiply: h = f*g in Z_q[x]/(x^n+1) via NTT. O(n log n).
-   ψ = 3^((q-1)/(2n)) is a primitive 2n-th root; ψ^n ≡ -1 encodes the wrap. */
 /* h = f*g in Z_q[x]/(x^n+1) at an explicit dimension.  n must be RNL_N or
    RNL_ALT_N — the only two the twiddle tables cover.  Python's _rnl_poly_mul and
-   Go's RnlPolyMul have always taken n; this brings C into line (TODO #223). */
+   Go's RnlPolyMul have always taken n; this brings C into line (TODO #223).
+   Runs on the backend rnl_twiddle_init selected (_rnl_poly_mul_soft is the
+   reference); every backend gives the same canonical output. */
 static void rnl_poly_mul_dim(int32_t *h, const int32_t *f, const int32_t *g, int n)
 {
-    int32_t fa[RNL_N], ga[RNL_N], ha[RNL_N];   /* RNL_N is the larger of the two */
-    const uint32_t *psi_pow, *psi_inv_pow;
-    uint32_t inv_n;
-    int i;
     rnl_twiddle_init();
-    if (n == RNL_ALT_N) {
-        psi_pow = rnl_tw_alt.psi_pow; psi_inv_pow = rnl_tw_alt.psi_inv_pow;
-        inv_n   = rnl_tw_alt.inv_n;
-    } else if (n == RNL_N) {
-        psi_pow = rnl_tw.psi_pow;     psi_inv_pow = rnl_tw.psi_inv_pow;
-        inv_n   = rnl_tw.inv_n;
-    } else {
+    if (n != RNL_ALT_N && n != RNL_N) {
         /* No twiddle table for this dimension.  Falling through to the RNL_N
            table would silently produce garbage, which for a key-exchange
            primitive is worse than stopping. */
         fputs("rnl_poly_mul_dim: unsupported ring dimension\n", stderr);
         exit(1);
     }
-    for (i = 0; i < n; i++) {
-        fa[i] = (int32_t)rnl_mulmodq((uint32_t)f[i], psi_pow[i]);
-        ga[i] = (int32_t)rnl_mulmodq((uint32_t)g[i], psi_pow[i]);
-    }
-    rnl_ntt_ex(fa, n, RNL_Q, 0, inv_n);
-    rnl_ntt_ex(ga, n, RNL_Q, 0, inv_n);
-    for (i = 0; i < n; i++)
-        ha[i] = (int32_t)rnl_mulmodq((uint32_t)fa[i], (uint32_t)ga[i]);
-    rnl_ntt_ex(ha, n, RNL_Q, 1, inv_n);
-    for (i = 0; i < n; i++)
-        h[i] = (int32_t)rnl_mulmodq((uint32_t)ha[i], psi_inv_pow[i]);
+    _rnl_poly_mul_kern(h, f, g, n, n == RNL_N ? rnl_tw.inv_n : rnl_tw_alt.inv_n);
 }
 
 static void rnl_poly_mul(rnl_poly_t h, const rnl_poly_t f, const rnl_poly_t g)
@@ -1301,6 +3334,11 @@ static void rnl_poly_add(rnl_poly_t h, const rnl_poly_t f, const rnl_poly_t g)
 static void rnl_round_dim(int32_t *out, const int32_t *in, int from_q, int to_p, int n)
 {
     int i;
+    if (from_q == RNL_Q && to_p == RNL_P) {
+        rnl_twiddle_init();
+        _rnl_round_qp(out, in, n);
+        return;
+    }
     for (i = 0; i < n; i++)
         out[i] = (int32_t)(((int64_t)in[i] * to_p + from_q / 2) / from_q % to_p);
 }
@@ -1313,6 +3351,11 @@ static void rnl_round(int32_t *out, const rnl_poly_t in, int from_q, int to_p)
 static void rnl_lift_dim(int32_t *out, const int32_t *in, int from_p, int to_q, int n)
 {
     int i;
+    if (from_p == RNL_P && to_q == RNL_Q) {
+        rnl_twiddle_init();
+        _rnl_lift_pq(out, in, n);
+        return;
+    }
     for (i = 0; i < n; i++)
         out[i] = (int32_t)(((int64_t)in[i] * to_q + from_p / 2) / from_p % to_q);
 }
@@ -1335,7 +3378,7 @@ static void rnl_rand_poly(rnl_poly_t p, FILE *urnd)
     int i = 0;
     while (i < RNL_N) {
         uint8_t buf[3];
-        if (fread(buf, 3, 1, urnd) != 1) { fputs("urandom error\n", stderr); exit(1); }
+        if (!urnd_read(urnd, buf, 3)) { fputs("urandom error\n", stderr); exit(1); }
         uint32_t v = ((uint32_t)buf[0] << 16) | ((uint32_t)buf[1] << 8) | buf[2];
         if (v < threshold)
             p[i++] = (int32_t)(v % RNL_Q);
@@ -1349,7 +3392,7 @@ static void rnl_cbd_poly_dim(int32_t *p, FILE *urnd, int n)
     int i;
     uint8_t buf[(RNL_N + 3) / 4];
     size_t need = (size_t)((n + 3) / 4);
-    if (fread(buf, 1, need, urnd) != need) {
+    if (!urnd_read(urnd, buf, need)) {
         fputs("urandom error\n", stderr); exit(1);
     }
     for (i = 0; i < n; i++) {
@@ -1364,7 +3407,7 @@ static void rnl_cbd_poly(rnl_poly_t p, FILE *urnd)
 {
     int i;
     uint8_t buf[(RNL_N + 3) / 4];
-    if (fread(buf, 1, sizeof(buf), urnd) != sizeof(buf)) {
+    if (!urnd_read(urnd, buf, sizeof(buf))) {
         fputs("urandom error\n", stderr); exit(1);
     }
     for (i = 0; i < RNL_N; i++) {
@@ -1544,24 +3587,41 @@ static void stern_hash(BitArray *out, const BitArray *items, int n_items, unsign
 /* H[row] = HFSCX-256(NL-FSCX_v1^I(ROL(seed XOR row, n/8), seed)) truncated to
  * n bits.  HFSCX-256-DM finalization removes the NL-FSCX range compression so H
  * is indistinguishable from a uniform binary matrix (TODO #88, v1.9.35). */
-static void stern_matrix_row(BitArray *out, const BitArray *seed, int row)
+/* Row before the final hash: nl_fscx_revolve_v1(ROL(seed ^ row, n/8), seed). */
+static void stern_matrix_row_pre(BitArray *out, const BitArray *seed, int row)
 {
     BitArray sxr = *seed, a0;
-    uint8_t digest[32];
     sxr.b[KEYBYTES - 1] ^= (uint8_t)(row & 0xFF);
     ba_rol_k(&a0, &sxr, KEYBITS / 8);
     nl_fscx_revolve_v1_ba(out, &a0, seed, I_VALUE);
+}
+
+static void stern_matrix_row(BitArray *out, const BitArray *seed, int row)
+{
+    uint8_t digest[32];
+    stern_matrix_row_pre(out, seed, row);
     hfscx_256(out->b, KEYBYTES, NULL, digest);
     memcpy(out->b, digest, KEYBYTES);
 }
 
 /* Build all SDF_N_ROWS rows of parity-check matrix H from seed.
-   Hot paths (sign/verify) call this once and reuse H via stern_syndrome_H. */
+   Hot paths (sign/verify) call this once and reuse H via stern_syndrome_H.
+   The row hashes are independent, so they run HFSCX_MB_LANES at a time. */
 static void stern_build_H(BitArray *H, const BitArray *seed)
 {
-    int i;
-    for (i = 0; i < SDF_N_ROWS; i++)
-        stern_matrix_row(&H[i], seed, i);
+    const uint8_t *in[HFSCX_MB_LANES];
+    uint8_t *out[HFSCX_MB_LANES];
+    BitArray pre[HFSCX_MB_LANES];
+    int i, j, n;
+    for (i = 0; i < SDF_N_ROWS; i += n) {
+        n = SDF_N_ROWS - i < HFSCX_MB_LANES ? SDF_N_ROWS - i : HFSCX_MB_LANES;
+        for (j = 0; j < n; j++) {
+            stern_matrix_row_pre(&pre[j], seed, i + j);
+            in[j]  = pre[j].b;
+            out[j] = H[i + j].b;
+        }
+        hfscx_256_xn(in, n, KEYBYTES, NULL, out);
+    }
 }
 
 /* Syndrome from prebuilt H: s = H*e^T mod 2, packed into syndr[SDF_SYNBYTES]. */
@@ -1685,7 +3745,7 @@ static void stern_rand_error(BitArray *e, FILE *urnd)
         uint8_t rnd;
         int j;
         do {
-            if (fread(&rnd, 1, 1, urnd) != 1) {
+            if (!urnd_read(urnd, &rnd, 1)) {
                 fputs("urandom error\n", stderr); exit(1);
             }
         } while ((unsigned int)rnd >= thresh);
@@ -2051,7 +4111,7 @@ static void stern_ring_sign(SternRingSig *sig,
             int b_pre;
             int tries;
             for (tries = 0; tries < 8; tries++) {
-                if (fread(&rnd1, 1, 1, urnd) != 1) { rnd1 = (uint8_t)(i ^ r); break; }
+                if (!urnd_read(urnd, &rnd1, 1)) { rnd1 = (uint8_t)(i ^ r); break; }
                 if (rnd1 != 255) break;
             }
             b_pre = (int)(rnd1 % 3u);
@@ -2224,7 +4284,7 @@ static void hpke_stern_f_decap_known(BitArray *K_out,
 /* HKEX-GF: derive public key pub = g^priv in GF(2^KEYBITS)*. */
 static inline void hkex_gf_pubkey(const BitArray *priv, BitArray *pub)
 {
-    gf_pow_ba(pub, &GF_GEN, priv);
+    gf_pow_gen_ba(pub, priv);
 }
 
 /* HKEX-GF: derive shared secret shared = their_pub^my_priv in GF(2^KEYBITS)*.
@@ -2236,7 +4296,7 @@ static inline int hkex_gf_agree(const BitArray *my_priv,
                                   BitArray *shared)
 {
     if (!gf_pub_is_valid(their_pub)) return 0;
-    gf_pow_ba(shared, their_pub, my_priv);
+    gf_pow_win_ba(shared, their_pub, my_priv);
     return 1;
 }
 
@@ -2254,6 +4314,32 @@ static inline void hske_decrypt(const BitArray *ct, const BitArray *key,
     ba_fscx_revolve(pt, ct, key, R_VALUE);
 }
 
+/* HSKE with a per-key cache of the closed-form B term (TODO #213): one
+ * hske_key_init per key, then every block in either direction costs three
+ * rotations and four XORs.  Output is identical to hske_encrypt/hske_decrypt. */
+typedef struct {
+    FscxRevolveKey enc;
+    FscxRevolveKey dec;
+} HskeKey;
+
+static inline void hske_key_init(HskeKey *hk, const BitArray *key)
+{
+    fscx_revolve_key_init(&hk->enc, key, I_VALUE);
+    fscx_revolve_key_init(&hk->dec, key, R_VALUE);
+}
+
+static inline void hske_encrypt_k(const BitArray *pt, const HskeKey *hk,
+                                   BitArray *ct)
+{
+    fscx_revolve_key_apply(ct, pt, &hk->enc);
+}
+
+static inline void hske_decrypt_k(const BitArray *ct, const HskeKey *hk,
+                                   BitArray *pt)
+{
+    fscx_revolve_key_apply(pt, ct, &hk->dec);
+}
+
 /* HPKS: sign msg with private key priv.
  * Outputs commitment R = g^k and scalar s = (k - priv*e) mod ord.
  * Send (R, s) to the verifier along with the message. */
@@ -2262,7 +4348,7 @@ static inline void hpks_sign(const BitArray *msg, const BitArray *priv,
 {
     BitArray k, e, ae;
     ba_rand(&k, urnd);
-    gf_pow_ba(R_out, &GF_GEN, &k);
+    gf_pow_gen_ba(R_out, &k);
     ba_fscx_revolve(&e, R_out, msg, I_VALUE);
     ba_mul_mod_ord(&ae, priv, &e);
     ba_sub_mod_ord(s_out, &k, &ae);
@@ -2275,12 +4361,10 @@ static inline void hpks_sign(const BitArray *msg, const BitArray *priv,
 static inline int hpks_verify(const BitArray *msg, const BitArray *pub,
                                 const BitArray *R, const BitArray *s)
 {
-    BitArray e, gs, Ce, lhs;
+    BitArray e, lhs;
     if (!gf_pub_is_valid(pub)) return 0;
     ba_fscx_revolve(&e, R, msg, I_VALUE);
-    gf_pow_ba(&gs, &GF_GEN, s);
-    gf_pow_ba(&Ce, pub, &e);
-    gf_mul_ba(&lhs, &gs, &Ce);
+    gf_pow2_vartime_ba(&lhs, &GF_GEN, s, pub, &e);   /* g^s · pub^e; all public */
     return ba_equal(&lhs, R);
 }
 
@@ -2295,8 +4379,8 @@ static inline int hpke_encrypt(const BitArray *pt, const BitArray *pub,
     BitArray r, enc_key;
     if (!gf_pub_is_valid(pub)) return 0;
     ba_rand(&r, urnd);
-    gf_pow_ba(R_out, &GF_GEN, &r);
-    gf_pow_ba(&enc_key, pub, &r);
+    gf_pow_gen_ba(R_out, &r);
+    gf_pow_win_ba(&enc_key, pub, &r);
     ba_fscx_revolve(ct_out, pt, &enc_key, I_VALUE);
     return 1;
 }
@@ -2309,7 +4393,7 @@ static inline int hpke_decrypt(const BitArray *ct, const BitArray *R,
 {
     BitArray dec_key;
     if (!gf_pub_is_valid(R)) return 0;
-    gf_pow_ba(&dec_key, R, priv);
+    gf_pow_win_ba(&dec_key, R, priv);
     ba_fscx_revolve(pt_out, ct, &dec_key, R_VALUE);
     return 1;
 }
@@ -2439,7 +4523,7 @@ static int rnl_sigma_sign(const int32_t *s, const int32_t *m, const int32_t *Cp,
         for (i = 0; i < n; i++) {
             uint32_t v;
             do { uint8_t b[3];
-                 if (fread(b, 1, 3, urnd) != 3) { fputs("urandom\n", stderr); exit(1); }
+                 if (!urnd_read(urnd, b, 3)) { fputs("urandom\n", stderr); exit(1); }
                  v = ((uint32_t)b[0] << 16) | ((uint32_t)b[1] << 8) | b[2];
             } while (v >= thresh);
             y[i] = (int32_t)(v % range) - gamma;
@@ -2673,11 +4757,11 @@ static void zkp_nl_keygen(int n, FILE *urnd, uint64_t *A_out, uint64_t *B_out, u
     uint64_t A = 0, B = 0;
     uint8_t rb;
     for (k = 0; k < nb; k++) {
-        if (fread(&rb, 1, 1, urnd) != 1) { fputs("urandom\n", stderr); exit(1); }
+        if (!urnd_read(urnd, &rb, 1)) { fputs("urandom\n", stderr); exit(1); }
         A = (A << 8) | rb;
     }
     for (k = 0; k < nb; k++) {
-        if (fread(&rb, 1, 1, urnd) != 1) { fputs("urandom\n", stderr); exit(1); }
+        if (!urnd_read(urnd, &rb, 1)) { fputs("urandom\n", stderr); exit(1); }
         B = (B << 8) | rb;
     }
     A &= mask; B &= mask;
@@ -2710,16 +4794,16 @@ static ZkpNlRound *zkp_nl_prove(uint64_t A, uint64_t B, uint64_t y, int n, int r
         uint64_t s0 = 0, s1 = 0;
         uint8_t rb;
         for (k = 0; k < nb; k++) {
-            if (fread(&rb,1,1,urnd)!=1){fputs("urandom\n",stderr);exit(1);} s0=(s0<<8)|rb;
+            if (!urnd_read(urnd, &rb, 1)){fputs("urandom\n",stderr);exit(1);} s0=(s0<<8)|rb;
         }
         for (k = 0; k < nb; k++) {
-            if (fread(&rb,1,1,urnd)!=1){fputs("urandom\n",stderr);exit(1);} s1=(s1<<8)|rb;
+            if (!urnd_read(urnd, &rb, 1)){fputs("urandom\n",stderr);exit(1);} s1=(s1<<8)|rb;
         }
         s0 &= mask; s1 &= mask;
         uint64_t s2 = (A ^ s0 ^ s1) & mask;
         all_sh[j*3+0] = s0; all_sh[j*3+1] = s1; all_sh[j*3+2] = s2;
         for (p = 0; p < 3; p++)
-            if (fread(all_tp+(j*3+p)*32, 1, 32, urnd) != 32)
+            if (!urnd_read(urnd, all_tp+(j*3+p)*32, 32))
                 { fputs("urandom tape\n", stderr); exit(1); }
 
         zkp_nl_eval_3p(s0, s1, s2,
@@ -2975,9 +5059,9 @@ static ZkpNlPpRound *zkp_nl_pp_prove(uint64_t A, uint64_t B, uint64_t y,
         uint64_t s0, s1, s2;
         uint8_t tmpbuf[ZKPP_SEED_BYTES + 4];
 
-        if (fread(r->seeds[0], 1, ZKPP_SEED_BYTES, urnd) != ZKPP_SEED_BYTES ||
-            fread(r->seeds[1], 1, ZKPP_SEED_BYTES, urnd) != ZKPP_SEED_BYTES ||
-            fread(r->seeds[2], 1, ZKPP_SEED_BYTES, urnd) != ZKPP_SEED_BYTES)
+        if (!urnd_read(urnd, r->seeds[0], ZKPP_SEED_BYTES) ||
+            !urnd_read(urnd, r->seeds[1], ZKPP_SEED_BYTES) ||
+            !urnd_read(urnd, r->seeds[2], ZKPP_SEED_BYTES))
             { fputs("urandom seed\n", stderr); exit(1); }
 
         zkpp_derive(r->seeds[0], nb, &s0, r->tapes[0]); s0 &= mask;
@@ -3227,12 +5311,12 @@ static int zkp_nl_pp_verify(uint64_t B, uint64_t y, int n, int rounds,
 static inline void haccum_leaf(const uint8_t *data, size_t dlen,
                                 uint8_t out[KEYBYTES])
 {
-    uint8_t *buf = (uint8_t *)malloc(1 + dlen);
-    if (!buf) { fprintf(stderr, "haccum_leaf: out of memory\n"); exit(1); }
-    buf[0] = 0x00;
-    if (dlen) memcpy(buf + 1, data, dlen);
-    hfscx_256(buf, 1 + dlen, NULL, out);
-    free(buf);
+    static const uint8_t tag = 0x00;
+    HfscxCtx c;
+    hfscx_256_init(&c, NULL);
+    hfscx_256_update(&c, &tag, 1);
+    hfscx_256_update(&c, data, dlen);
+    hfscx_256_final(&c, out);
 }
 
 static inline void haccum_node(const uint8_t left[KEYBYTES],
@@ -3246,6 +5330,34 @@ static inline void haccum_node(const uint8_t left[KEYBYTES],
     hfscx_256(buf, sizeof(buf), NULL, out);
 }
 
+/* nodes[i] = haccum_node(nodes[2i], nodes[2i+1]) for i < sz/2, in place,
+   HFSCX_MB_LANES nodes per multi-buffer call.  Every input of a batch is
+   absorbed before any output of that batch is written, and outputs never
+   overlap a later batch's inputs. */
+static void haccum_level(uint8_t (*nodes)[KEYBYTES], size_t sz)
+{
+    static const uint8_t tag = 0x01;
+    const uint8_t *tg[HFSCX_MB_LANES], *l[HFSCX_MB_LANES], *r[HFSCX_MB_LANES];
+    uint8_t *o[HFSCX_MB_LANES];
+    size_t i, half = sz / 2;
+    int j, n;
+    for (i = 0; i < half; i += (size_t)n) {
+        HfscxCtxX c;
+        n = half - i < HFSCX_MB_LANES ? (int)(half - i) : HFSCX_MB_LANES;
+        for (j = 0; j < n; j++) {
+            tg[j] = &tag;
+            l[j]  = nodes[2 * (i + j)];
+            r[j]  = nodes[2 * (i + j) + 1];
+            o[j]  = nodes[i + j];
+        }
+        hfscx_256_xn_init(&c, n, NULL);
+        hfscx_256_xn_update(&c, tg, 1);
+        hfscx_256_xn_update(&c, l, KEYBYTES);
+        hfscx_256_xn_update(&c, r, KEYBYTES);
+        hfscx_256_xn_final(&c, o);
+    }
+}
+
 static void haccum_root(const uint8_t (*leaf_hashes)[KEYBYTES], size_t n,
                          uint8_t out[KEYBYTES])
 {
@@ -3257,8 +5369,7 @@ static void haccum_root(const uint8_t (*leaf_hashes)[KEYBYTES], size_t n,
     for (i = 0; i < n;  i++) memcpy(nodes[i], leaf_hashes[i], KEYBYTES);
     for (     ; i < sz; i++) memset(nodes[i], 0,               KEYBYTES);
     while (sz > 1) {
-        for (i = 0; i < sz / 2; i++)
-            haccum_node(nodes[2*i], nodes[2*i+1], nodes[i]);
+        haccum_level(nodes, sz);
         sz /= 2;
     }
     memcpy(out, nodes[0], KEYBYTES);
@@ -3287,8 +5398,7 @@ static uint8_t *haccum_prove(const uint8_t (*leaf_hashes)[KEYBYTES], size_t n,
         size_t sib = cur ^ 1;
         memcpy(path + (size_t)d * KEYBYTES, nodes[sib], KEYBYTES);
         d++;
-        for (i = 0; i < sz / 2; i++)
-            haccum_node(nodes[2*i], nodes[2*i+1], nodes[i]);
+        haccum_level(nodes, sz);
         sz /= 2; cur >>= 1;
     }
     free(nodes);
@@ -3325,14 +5435,11 @@ static inline void fpe_derive_b(const uint8_t *key, size_t klen,
                                  const uint8_t *ctx, size_t clen,
                                  BitArray *B)
 {
-    uint8_t *tbuf = (uint8_t *)malloc(klen + clen);
-    uint8_t tweak[KEYBYTES];
-    if (!tbuf) { fprintf(stderr, "fpe: out of memory\n"); exit(1); }
-    if (klen) memcpy(tbuf,       key, klen);
-    if (clen) memcpy(tbuf + klen, ctx, clen);
-    hfscx_256(tbuf, klen + clen, NULL, tweak);
-    free(tbuf);
-    memcpy(B->b, tweak, KEYBYTES);
+    HfscxCtx c;
+    hfscx_256_init(&c, NULL);
+    hfscx_256_update(&c, key, klen);
+    hfscx_256_update(&c, ctx, clen);
+    hfscx_256_final(&c, B->b);
 }
 
 static inline void fpe_encrypt(const BitArray *pt,
@@ -3367,22 +5474,32 @@ static inline void twk_derive_b(const uint8_t *key, size_t klen,
                                   uint64_t sector, uint32_t bidx,
                                   BitArray *B)
 {
-    uint8_t *tbuf = (uint8_t *)malloc(klen + 12);
-    uint8_t tweak[KEYBYTES];
+    uint8_t sb[12];
+    HfscxCtx c;
     int i;
-    if (!tbuf) { fprintf(stderr, "twk: out of memory\n"); exit(1); }
-    if (klen) memcpy(tbuf, key, klen);
     for (i = 7; i >= 0; i--) {
-        tbuf[klen + (size_t)i] = (uint8_t)(sector & 0xff);
+        sb[i] = (uint8_t)(sector & 0xff);
         sector >>= 8;
     }
-    tbuf[klen + 8]  = (uint8_t)((bidx >> 24) & 0xff);
-    tbuf[klen + 9]  = (uint8_t)((bidx >> 16) & 0xff);
-    tbuf[klen + 10] = (uint8_t)((bidx >>  8) & 0xff);
-    tbuf[klen + 11] = (uint8_t)( bidx        & 0xff);
-    hfscx_256(tbuf, klen + 12, NULL, tweak);
-    free(tbuf);
-    memcpy(B->b, tweak, KEYBYTES);
+    sb[8]  = (uint8_t)((bidx >> 24) & 0xff);
+    sb[9]  = (uint8_t)((bidx >> 16) & 0xff);
+    sb[10] = (uint8_t)((bidx >>  8) & 0xff);
+    sb[11] = (uint8_t)( bidx        & 0xff);
+    hfscx_256_init(&c, NULL);
+    hfscx_256_update(&c, key, klen);
+    hfscx_256_update(&c, sb, sizeof sb);
+    hfscx_256_final(&c, B->b);
+}
+
+/* Keyed context for sector s, block i.  The tweak changes per block, so the
+   context is built once per block and serves both directions. */
+static inline void twk_ctx_init(NlV2Ctx *ctx, const uint8_t *key, size_t klen,
+                                uint64_t sector, uint32_t bidx)
+{
+    BitArray B;
+    twk_derive_b(key, klen, sector, bidx, &B);
+    nl_v2_ctx_init(ctx, &B);
+    explicit_bzero(&B, sizeof B);
 }
 
 static inline void twk_encrypt(const BitArray *block,
@@ -3390,9 +5507,10 @@ static inline void twk_encrypt(const BitArray *block,
                                  uint64_t sector, uint32_t bidx,
                                  BitArray *ct)
 {
-    BitArray B;
-    twk_derive_b(key, klen, sector, bidx, &B);
-    nl_fscx_revolve_v2_ba(ct, block, &B, I_VALUE);
+    NlV2Ctx ctx;
+    twk_ctx_init(&ctx, key, klen, sector, bidx);
+    nl_v2_ctx_revolve(ct, block, &ctx, I_VALUE);
+    explicit_bzero(&ctx, sizeof ctx);
 }
 
 static inline void twk_decrypt(const BitArray *ct,
@@ -3400,9 +5518,10 @@ static inline void twk_decrypt(const BitArray *ct,
                                  uint64_t sector, uint32_t bidx,
                                  BitArray *block)
 {
-    BitArray B;
-    twk_derive_b(key, klen, sector, bidx, &B);
-    nl_fscx_revolve_v2_inv_ba(block, ct, &B, I_VALUE);
+    NlV2Ctx ctx;
+    twk_ctx_init(&ctx, key, klen, sector, bidx);
+    nl_v2_ctx_revolve_inv(block, ct, &ctx, I_VALUE);
+    explicit_bzero(&ctx, sizeof ctx);
 }
 
 /* ─────────────────────────────────────────────────────────────────────────────
@@ -3533,125 +5652,37 @@ static int ba_cmp256(const BitArray *a, const BitArray *b)
     return 0;
 }
 
-/* 33-byte (257-bit) big-endian integer helpers used only by ba_modinv_ord. */
-static int _ba33_cmp(const uint8_t *a, const uint8_t *b)
-{
-    int i;
-    for (i = 0; i < 33; i++) {
-        if (a[i] < b[i]) return -1;
-        if (a[i] > b[i]) return  1;
-    }
-    return 0;
-}
-static int _ba33_iszero(const uint8_t *a)
-{
-    int i;
-    for (i = 0; i < 33; i++) if (a[i]) return 0;
-    return 1;
-}
+/* λ(2^256 − 1) − 1 in ord limb order.  2^256 − 1 = F0·F1·…·F7 is squarefree
+   with eleven prime factors p (3, 5, 17, 257, 641, 65537, 274177, 6700417,
+   67280421310721, 59649589127497217, 5704689200685129054721), and the
+   Carmichael exponent λ = lcm(p − 1) is only 183 bits. */
+static const uint64_t ORD_LAMBDA_M1[4] = {
+    0xc86d75fc01b4ffffULL, 0x4ae54497c80cec0bULL, 0x0060f043d9e21a5cULL, 0
+};
+#define ORD_LAMBDA_BITS 183
 
-/* ba_modinv_ord: compute dst = a^{-1} mod (2^KEYBITS-1) via binary extended GCD.
-   Requires gcd(a, ORD) == 1; result is undefined if gcd != 1.
-   ORD = 2^256-1 is all-0xFF bytes.
-   Uses 33-byte (257-bit) big-endian arrays for the Bezout coefficients to
-   avoid overflow when adding ORD to make them positive. */
+/* ba_modinv_ord: dst = a^{-1} mod (2^KEYBITS-1), computed as a^(λ−1).
+   Requires gcd(a, ORD) == 1; otherwise dst·a != 1 (callers check).  The
+   exponent is a public constant, so the 4-bit fixed-window ladder (180
+   squarings, 59 multiplies including the table) runs in constant time in a. */
 static void ba_modinv_ord(BitArray *dst, const BitArray *a)
 {
-    static const uint8_t ORD33[33] = {
-        0x00,
-        0xFF,0xFF,0xFF,0xFF, 0xFF,0xFF,0xFF,0xFF,
-        0xFF,0xFF,0xFF,0xFF, 0xFF,0xFF,0xFF,0xFF,
-        0xFF,0xFF,0xFF,0xFF, 0xFF,0xFF,0xFF,0xFF,
-        0xFF,0xFF,0xFF,0xFF, 0xFF,0xFF,0xFF,0xFF
-    };
-    /* 257-bit big-endian unsigned arithmetic helpers (inline, avoiding recursion) */
-#define ADD33(dst33, a33, b33) do { \
-        uint16_t _c = 0; int _i; \
-        for (_i = 32; _i >= 0; _i--) { \
-            uint16_t _s = (uint16_t)(a33)[_i] + (b33)[_i] + _c; \
-            (dst33)[_i] = (uint8_t)_s; _c = _s >> 8; \
-        } \
-    } while(0)
-#define SUB33(dst33, a33, b33) do { \
-        int16_t _bor = 0; int _i; \
-        for (_i = 32; _i >= 0; _i--) { \
-            int16_t _s = (int16_t)(a33)[_i] - (int16_t)(b33)[_i] - _bor; \
-            (dst33)[_i] = (uint8_t)_s; _bor = (_s < 0) ? 1 : 0; \
-        } \
-    } while(0)
-#define SHR1_33(arr) do { \
-        int _i; \
-        for (_i = 32; _i > 0; _i--) \
-            (arr)[_i] = (uint8_t)(((arr)[_i] >> 1) | ((arr)[_i-1] << 7)); \
-        (arr)[0] >>= 1; \
-    } while(0)
-#define IS_ODD33(arr)  ((arr)[32] & 1u)
-
-    /* non-macro helpers for CMP33 and IS_ZERO33 to avoid GNU statement-expr */
-#define CMP33(a33, b33) _ba33_cmp(a33, b33)
-#define IS_ZERO33(arr)  _ba33_iszero(arr)
-
-
-    /* u, v: 33-byte big-endian integers (u = a, v = ORD) */
-    uint8_t u[33], v[33], x1[33], x2[33], tmp[33];
-    int i;
-
-    /* u = a (zero-extend to 33 bytes) */
-    u[0] = 0;
-    memcpy(u + 1, a->b, KEYBYTES);
-    /* v = ORD */
-    memcpy(v, ORD33, 33);
-    /* x1 = 1, x2 = 0 */
-    memset(x1, 0, 33); x1[32] = 1;
-    memset(x2, 0, 33);
-
-    /* Binary extended GCD: invariant a*x1 ≡ u (mod ORD), a*x2 ≡ v (mod ORD) */
-    for (i = 0; i < 2 * KEYBITS + 64; i++) {
-        if (IS_ZERO33(u)) break;
-
-        if (!IS_ODD33(u)) {
-            SHR1_33(u);
-            if (IS_ODD33(x1)) { ADD33(tmp, x1, ORD33); memcpy(x1, tmp, 33); }
-            SHR1_33(x1);
-            continue;
-        }
-        if (!IS_ODD33(v)) {
-            SHR1_33(v);
-            if (IS_ODD33(x2)) { ADD33(tmp, x2, ORD33); memcpy(x2, tmp, 33); }
-            SHR1_33(x2);
-            continue;
-        }
-        if (CMP33(u, v) >= 0) {
-            SUB33(u, u, v);
-            /* x1 = (x1 - x2) mod ORD: if x1 < x2, add ORD first */
-            if (CMP33(x1, x2) < 0) { ADD33(tmp, x1, ORD33); memcpy(x1, tmp, 33); }
-            SUB33(x1, x1, x2);
-        } else {
-            SUB33(v, v, u);
-            if (CMP33(x2, x1) < 0) { ADD33(tmp, x2, ORD33); memcpy(x2, tmp, 33); }
-            SUB33(x2, x2, x1);
-        }
+    uint64_t tbl[16][4], r[4];
+    int k, d;
+    memset(tbl[0], 0, sizeof(tbl[0]));
+    tbl[0][0] = 1;
+    gf_le_load(tbl[1], a);
+    for (k = 2; k < 16; k++) ord_mul_le(tbl[k], tbl[k - 1], tbl[1]);
+    k = (ORD_LAMBDA_BITS + 3) / 4 - 1;
+    d = (int)((ORD_LAMBDA_M1[k >> 4] >> ((k & 15) * 4)) & 0xF);
+    memcpy(r, tbl[d], sizeof(r));
+    for (k--; k >= 0; k--) {
+        ord_sqr_le(r, r); ord_sqr_le(r, r);
+        ord_sqr_le(r, r); ord_sqr_le(r, r);
+        d = (int)((ORD_LAMBDA_M1[k >> 4] >> ((k & 15) * 4)) & 0xF);
+        ord_mul_le(r, r, tbl[d]);
     }
-    /* At exit: if u != 0, gcd was found via u; coefficient is x1.
-       Otherwise v == gcd (should be 1) and x2 is the inverse. */
-    if (!IS_ZERO33(u))
-        memcpy(dst->b, u + 1, KEYBYTES);  /* fallback: shouldn't happen if gcd==1 */
-    else
-        memcpy(dst->b, x2 + 1, KEYBYTES);
-
-    /* Reduce mod ORD: if result is all-0xFF (== ORD), set to 0
-       (ORD ≡ 0 mod ORD; this can't be a valid inverse of any element != 0) */
-    { int all_ff = 1;
-      for (i = 0; i < KEYBYTES; i++) all_ff &= (dst->b[i] == 0xFF);
-      if (all_ff) memset(dst->b, 0, KEYBYTES);
-    }
-
-#undef ADD33
-#undef SUB33
-#undef SHR1_33
-#undef CMP33
-#undef IS_ZERO33
-#undef IS_ODD33
+    gf_le_store(dst, r);
 }
 
 /* oprf_hash_to_field: HFSCX-256(data) → non-zero element of GF(2^KEYBITS)*. */
@@ -3686,13 +5717,13 @@ static void oprf_blind(const uint8_t *x, size_t xlen,
         ba_modinv_ord(&r_inv, r_out);
         ba_mul_mod_ord(&check, r_out, &r_inv);
     } while (ba_cmp256(&check, &ONE_BA) != 0);
-    gf_pow_ba(alpha_out, &hx, r_out);
+    gf_pow_win_ba(alpha_out, &hx, r_out);
 }
 
 /* oprf_eval: server step — compute beta = alpha^k. */
 static void oprf_eval(BitArray *beta, const BitArray *alpha, const BitArray *k)
 {
-    gf_pow_ba(beta, alpha, k);
+    gf_pow_win_ba(beta, alpha, k);
 }
 
 /* oprf_unblind: client step — recover F(k,x) = beta^{r^{-1} mod ORD}. */
@@ -3700,7 +5731,7 @@ static void oprf_unblind(BitArray *F, const BitArray *beta, const BitArray *r)
 {
     BitArray r_inv;
     ba_modinv_ord(&r_inv, r);
-    gf_pow_ba(F, beta, &r_inv);
+    gf_pow_win_ba(F, beta, &r_inv);
 }
 
 /* oprf_direct: direct PRF evaluation F(k, x) = H(x)^k (server-only, not oblivious). */
@@ -3708,7 +5739,7 @@ static void oprf_direct(BitArray *F, const uint8_t *x, size_t xlen, const BitArr
 {
     BitArray hx;
     oprf_hash_to_field(&hx, x, xlen);
-    gf_pow_ba(F, &hx, k);
+    gf_pow_win_ba(F, &hx, k);
 }
 
 /* ─────────────────────────────────────────────────────────────────────────────
@@ -3768,10 +5799,10 @@ static void hpake_register(HpakeRecord *rec,
 {
     uint8_t b_bytes[4];
     BitArray F;
-    if (fread(rec->salt, 1, 32, urnd) != 32) { fputs("urnd fail\n", stderr); exit(1); }
+    if (!urnd_read(urnd, rec->salt, 32)) { fputs("urnd fail\n", stderr); exit(1); }
     oprf_direct(&F, password, pwlen, oprf_key);
     uint32_t zkp_A = _hpake_zkp_witness(F.b);
-    if (fread(b_bytes, 1, 4, urnd) != 4)     { fputs("urnd fail\n", stderr); exit(1); }
+    if (!urnd_read(urnd, b_bytes, 4)) { fputs("urnd fail\n", stderr); exit(1); }
     rec->B = ((uint32_t)b_bytes[0] << 24) | ((uint32_t)b_bytes[1] << 16)
            | ((uint32_t)b_bytes[2] <<  8) |  (uint32_t)b_bytes[3];
     rec->y = (uint32_t)zkp_nl_f1((uint64_t)zkp_A, (uint64_t)rec->B, HPAKE_ZKP_N);
@@ -3801,8 +5832,8 @@ static int hpake_login_demo(uint8_t session_key[KEYBYTES],
     rnl_keygen(s_s, C_s, m_blind, urnd);
 
     uint8_t pake_n_A[KEYBYTES], pake_n_B[KEYBYTES];
-    if (fread(pake_n_A, 1, KEYBYTES, urnd) != KEYBYTES) return 0;
-    if (fread(pake_n_B, 1, KEYBYTES, urnd) != KEYBYTES) return 0;
+    if (!urnd_read(urnd, pake_n_A, KEYBYTES)) return 0;
+    if (!urnd_read(urnd, pake_n_B, KEYBYTES)) return 0;
 
     BitArray K_raw_c, K_raw_s;
     uint8_t hint[RNL_N / 8];
@@ -3846,27 +5877,11 @@ static int hpake_login_demo(uint8_t session_key[KEYBYTES],
 /* dst = (a + b) mod (2^256-1) */
 static void ba_add_mod_ord(BitArray *dst, const BitArray *a, const BitArray *b)
 {
-    uint16_t carry = 0;
-    int i, all_ff;
-    for (i = KEYBYTES - 1; i >= 0; i--) {
-        uint16_t s = (uint16_t)a->b[i] + (uint16_t)b->b[i] + carry;
-        dst->b[i] = (uint8_t)s;
-        carry = s >> 8;
-    }
-    if (carry) {
-        /* wrapped: add 1 (because 2^256 mod (2^256-1) = 1) */
-        uint16_t add1 = 1;
-        for (i = KEYBYTES - 1; i >= 0; i--) {
-            uint16_t s = (uint16_t)dst->b[i] + add1;
-            dst->b[i] = (uint8_t)s;
-            add1 = s >> 8;
-            if (!add1) break;
-        }
-    }
-    /* 2^256-1 is the identity for addition mod ord; map it to 0 */
-    all_ff = 1;
-    for (i = 0; i < KEYBYTES; i++) all_ff &= (dst->b[i] == 0xFF);
-    if (all_ff) memset(dst->b, 0, KEYBYTES);
+    uint64_t x[4], y[4], r[4];
+    gf_le_load(x, a);
+    gf_le_load(y, b);
+    ord_fold_le(r, x, y);
+    gf_le_store(dst, r);
 }
 
 /* Aliases used by hpkst_sign */
@@ -3917,7 +5932,7 @@ static void _hpkst_aggregate(const BitArray *pubkeys, size_t n,
         _hpkst_mu_coeff(L_bytes, llen, &pubkeys[j], mu_out[j]);
         BitArray mu_ba, Cj_pow;
         memcpy(mu_ba.b, mu_out[j], KEYBYTES);
-        gf_pow_ba(&Cj_pow, &pubkeys[j], &mu_ba);
+        gf_pow_win_ba(&Cj_pow, &pubkeys[j], &mu_ba);
         gf_mul_ba(C_agg, C_agg, &Cj_pow);
     }
 }
@@ -3973,7 +5988,7 @@ static void hpkst_sign(const BitArray *secrets, const BitArray *pubkeys, size_t
     memset(R_out->b, 0, KEYBYTES); R_out->b[KEYBYTES-1] = 1;
     for (size_t j = 0; j < n; j++) {
         BitArray R_j;
-        gf_pow_ba(&R_j, &GF_GEN_BA, &nonces[j]);
+        gf_pow_gen_ba(&R_j, &nonces[j]);
         gf_mul_ba(R_out, R_out, &R_j);
     }
 
@@ -4031,14 +6046,115 @@ static void hpkst_sign(const BitArray *secrets, const BitArray *pubkeys, size_t
 static int hpkst_verify(const BitArray *C_agg, const BitArray *R,
                          const BitArray *s, const BitArray *msg)
 {
-    BitArray e, gs, Ce, lhs;
+    BitArray e, lhs;
     nl_fscx_revolve_v1_ba(&e, R, msg, I_VALUE);
-    gf_pow_ba(&gs, &GF_GEN_BA, s);
-    gf_pow_ba(&Ce, C_agg, &e);
-    gf_mul_ba(&lhs, &gs, &Ce);
+    gf_pow2_vartime_ba(&lhs, &GF_GEN_BA, s, C_agg, &e);
     return ba_equal(&lhs, R);
 }
 
+/* ─────────────────────────────────────────────────────────────────────────────
+ * HPKS batch verification (random linear combination)
+ *
+ * For signatures (R_i, s_i) on msg_i under C_i, with e_i = fscx_revolve(R_i,
+ * msg_i, n/4) and fresh random 128-bit weights z_i:
+ *
+ *     g^(Σ z_i·s_i) · Π C_i^(z_i·e_i)  ==  Π R_i^(z_i)      (exponents mod ord)
+ *
+ * holds whenever every g^s_i · C_i^e_i == R_i.  Both sides are single
+ * multi-exponentiations (gf_multipow_vartime_ba), so n signatures share one
+ * 255-squaring chain plus one 127-squaring chain instead of n of each, and
+ * signatures under the same public key collapse into a single C^(Σ z_i·e_i)
+ * base (no per-signature table for C).  On failure the batch falls back to
+ * hpks_verify item by item to name the first bad index.
+ *
+ * Small-order errors: ord = 2^256 − 1 has small prime factors (3, 5, 17, 257,
+ * 641, 65537, 274177, 6700417, ...), and a malleated (R, s + ord/3) leaves an
+ * error of order 3 that a weight divisible by 3 would erase.  Every z_i is
+ * therefore redrawn until it is coprime to each prime factor of ord below
+ * 2^64 (HPKS_ORD_PRIMES), so an error term on a single signature can never
+ * vanish from the combination and such a batch is always rejected.  Errors
+ * planted on two or more signatures of one batch can still cancel modulo a
+ * small prime p (with probability about 1/(p − 1)); a verifier that must
+ * reject each malleated signature on its own, rather than detect that a set
+ * was tampered with, should call hpks_verify.
+ * ───────────────────────────────────────────────────────────────────────────── */
+
+#define HPKS_BATCH_WEIGHT_BYTES 16   /* 128-bit random weights */
+
+/* Prime factors of 2^256 − 1 below 2^56 (the remaining one has 73 bits). */
+static const uint64_t HPKS_ORD_PRIMES[] = {
+    3, 5, 17, 257, 641, 65537, 274177, 6700417,
+    UINT64_C(67280421310721), UINT64_C(59649589127497217)
+};
+
+/* 1 if z (big-endian) is divisible by none of HPKS_ORD_PRIMES. */
+static int _hpks_weight_coprime(const BitArray *z)
+{
+    size_t k, i;
+    for (k = 0; k < sizeof HPKS_ORD_PRIMES / sizeof HPKS_ORD_PRIMES[0]; k++) {
+        uint64_t r = 0;
+        for (i = 0; i < KEYBYTES; i++) r = ((r << 8) | z->b[i]) % HPKS_ORD_PRIMES[k];
+        if (r == 0) return 0;
+    }
+    return 1;
+}
+
+/* Returns 1 if all n signatures verify, 0 otherwise, and -1 (nothing
+ * verified) if the work arrays cannot be allocated.  On 0, *bad_idx (if not
+ * NULL) receives the first index that fails hpks_verify.  urnd supplies the
+ * weights; they must be unpredictable to whoever chose the signatures. */
+static inline int hpks_verify_batch(const BitArray *msgs, const BitArray *pubs,
+                                    const BitArray *Rs, const BitArray *ss, size_t n,
+                                    FILE *urnd, size_t *bad_idx)
+{
+    BitArray *lb, *le, *z, S, lhs, rhs, e, t;
+    size_t i, j, nb = 1;
+    int ok = 1;
+    if (n == 0) return 1;
+    if (n >= SIZE_MAX / sizeof(BitArray)) return -1;
+    lb = (BitArray *)malloc((n + 1) * sizeof(BitArray));
+    le = (BitArray *)malloc((n + 1) * sizeof(BitArray));
+    z  = (BitArray *)malloc(n * sizeof(BitArray));
+    if (!lb || !le || !z) { free(lb); free(le); free(z); return -1; }
+    memset(S.b, 0, KEYBYTES);
+    for (i = 0; i < n && ok; i++) {
+        if (!gf_pub_is_valid(&pubs[i])) { ok = 0; break; }
+        ba_fscx_revolve(&e, &Rs[i], &msgs[i], I_VALUE);
+        do {
+            ba_rand(&z[i], urnd);
+            memset(z[i].b, 0, KEYBYTES - HPKS_BATCH_WEIGHT_BYTES);
+        } while (!_hpks_weight_coprime(&z[i]));     /* also rules out z_i = 0 */
+        ba_mul_mod_ord(&t, &z[i], &ss[i]);          /* z_i·s_i */
+        ba_add_mod_ord(&S, &S, &t);
+        ba_mul_mod_ord(&t, &z[i], &e);              /* z_i·e_i */
+        for (j = 1; j < nb && !ba_equal(&lb[j], &pubs[i]); j++) ;
+        if (j < nb) {                               /* repeated signer: merge */
+            ba_add_mod_ord(&le[j], &le[j], &t);
+        } else {
+            lb[nb] = pubs[i];
+            le[nb++] = t;
+        }
+    }
+    if (ok) {
+        lb[0] = GF_GEN;
+        le[0] = S;
+        if (!gf_multipow_vartime_ba(&lhs, lb, le, nb) ||
+            !gf_multipow_vartime_ba(&rhs, Rs, z, n)) {
+            free(lb); free(le); free(z);
+            return -1;
+        }
+        ok = ba_equal(&lhs, &rhs);
+    }
+    free(lb); free(le); free(z);
+    if (ok) return 1;
+    for (i = 0; i < n; i++)
+        if (!hpks_verify(&msgs[i], &pubs[i], &Rs[i], &ss[i])) {
+            if (bad_idx) *bad_idx = i;
+            return 0;
+        }
+    return 1;   /* not reached: valid items satisfy the combined equation exactly */
+}
+
 /* ─────────────────────────────────────────────────────────────────────────────
  * 97 — HPKS-WOTS-F / HPKS-XMSS-F — Hash-based signatures (TODO #97/#102)
  *
@@ -4179,12 +6295,25 @@ static void hpks_xmss_keygen(uint8_t root[KEYBYTES],
     size_t num = (size_t)1 << h;
     uint8_t (*flat)[KEYBYTES] = (uint8_t (*)[KEYBYTES])malloc(num * KEYBYTES);
     if (!flat) { fprintf(stderr, "hpks_xmss_keygen: oom\n"); exit(1); }
-    for (size_t idx = 0; idx < num; idx++) {
-        BitArray sk[WOTS_L], pk[WOTS_L];
-        hpks_wots_keygen(sk, pk, master_seed, (uint32_t)idx);
-        uint8_t pk_bytes[WOTS_L * KEYBYTES];
-        _wots_pk_bytes(pk_bytes, pk);
-        haccum_leaf(pk_bytes, WOTS_L * KEYBYTES, flat[idx]);
+    /* Leaf hashes run HFSCX_MB_LANES at a time: haccum_leaf = H(0x00 || pk). */
+    static const uint8_t tag = 0x00;
+    uint8_t pk_bytes[HFSCX_MB_LANES][WOTS_L * KEYBYTES];
+    for (size_t idx = 0; idx < num; ) {
+        const uint8_t *tg[HFSCX_MB_LANES], *in[HFSCX_MB_LANES];
+        uint8_t *o[HFSCX_MB_LANES];
+        int n = num - idx < HFSCX_MB_LANES ? (int)(num - idx) : HFSCX_MB_LANES;
+        HfscxCtxX c;
+        for (int j = 0; j < n; j++) {
+            BitArray sk[WOTS_L], pk[WOTS_L];
+            hpks_wots_keygen(sk, pk, master_seed, (uint32_t)(idx + (size_t)j));
+            _wots_pk_bytes(pk_bytes[j], pk);
+            tg[j] = &tag; in[j] = pk_bytes[j]; o[j] = flat[idx + (size_t)j];
+        }
+        hfscx_256_xn_init(&c, n, NULL);
+        hfscx_256_xn_update(&c, tg, 1);
+        hfscx_256_xn_update(&c, in, WOTS_L * KEYBYTES);
+        hfscx_256_xn_final(&c, o);
+        idx += (size_t)n;
     }
     haccum_root(flat, num, root);
     *flat_leaves_out = (uint8_t *)flat;
@@ -4691,7 +6820,7 @@ static int hcred_prove(HcredProof *proof,
         int k;
 
         for (j = 0; j < 3; j++) {
-            if (fread(ex->seeds[j], 1, KEYBYTES, urnd) != KEYBYTES)
+            if (!urnd_read(urnd, ex->seeds[j], KEYBYTES))
                 goto prove_fail;
             hcred_tape_init(&tp[j], ex->seeds[j]);
         }